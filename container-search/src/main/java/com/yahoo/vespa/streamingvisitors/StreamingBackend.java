@@ -205,7 +205,12 @@ public class StreamingBackend extends VespaBackend {
 
         VisitorStatistics stats = visitor.getStatistics();
         result.setTotalHitCount(visitor.getTotalHitCount());
-        result.setCoverage(new Coverage(stats.getDocumentsVisited(), stats.getDocumentsVisited(), 1, 1));
+        Coverage coverage = new Coverage(stats.getDocumentsVisited(), stats.getDocumentsVisited(), 1, 1);
+        if (visitor.isEarlyTerminated()) {
+            // Not all documents were matched, so the total hit count is a lower bound
+            coverage.setDegradedReason(Coverage.DEGRADED_BY_MATCH_PHASE);
+        }
+        result.setCoverage(coverage);
         query.trace(visitor.getStatistics().toString(), false, 2);
         query.getContext(true).setProperty(STREAMING_STATISTICS, stats);
 
@@ -64,6 +64,7 @@ class StreamingVisitor extends VisitorDataHandler implements Visitor {
     private final VisitorParameters params = new VisitorParameters("");
     private List<SearchResult.Hit> hits = new ArrayList<>();
     private int totalHitCount = 0;
+    private boolean earlyTerminated = false;
 
     private final Map<String, DocumentSummary.Summary> summaryMap = new HashMap<>();
     private final Map<Integer, Grouping> groupingMap = new ConcurrentHashMap<>();
@@ -322,6 +323,7 @@ class StreamingVisitor extends VisitorDataHandler implements Visitor {
 
         synchronized (this) {
             totalHitCount += result.getTotalHitCount();
+            earlyTerminated |= result.isEarlyTerminated();
             hits = ListMerger.mergeIntoArrayList(hits, newHits, query.getOffset() + query.getHits());
         }
 
@@ -378,6 +380,9 @@ class StreamingVisitor extends VisitorDataHandler implements Visitor {
     @Override
     final public int getTotalHitCount() { return totalHitCount; }
 
+    @Override
+    final public synchronized boolean isEarlyTerminated() { return earlyTerminated; }
+
     @Override
     final public List<Grouping> getGroupings() {
         Collection<Grouping> groupings = groupingMap.values();
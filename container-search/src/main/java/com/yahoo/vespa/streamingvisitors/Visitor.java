@@ -29,6 +29,9 @@ interface Visitor {
 
     int getTotalHitCount();
 
+    /** Returns whether any content node stopped matching before all documents were visited. */
+    boolean isEarlyTerminated();
+
     List<Grouping> getGroupings();
 
     Trace getTrace();
@@ -57,6 +57,7 @@ public class StreamingSearcherTestCase {
         private final Map<String, DocumentSummary.Summary> summaryMap = new HashMap<>();
         private final List<Grouping> groupings = new ArrayList<>();
         int traceLevelOverride;
+        boolean earlyTerminated;
 
         MockVisitor(Query query, String searchCluster, Route route, String documentType, int traceLevelOverride) {
             this.query = query;
@@ -99,6 +100,9 @@ public class StreamingSearcherTestCase {
                 var matchFeatures = new MatchFeatureData(List.of("my_feature")).addHit();
                 matchFeatures.set(0, 7.0);
                 hits.get(0).setMatchFeatures(matchFeatures);
+            } else if (queryString.compareTo("earlyterminated") == 0) {
+                addResults(USERDOC_ID_PREFIX, 1, false);
+                earlyTerminated = true;
             }
         }
 
@@ -137,6 +141,11 @@ public class StreamingSearcherTestCase {
             return totalHitCount;
         }
 
+        @Override
+        public boolean isEarlyTerminated() {
+            return earlyTerminated;
+        }
+
         @Override
         public List<Grouping> getGroupings() {
             return groupings;
@@ -227,6 +236,12 @@ public class StreamingSearcherTestCase {
         assertEquals(7.0, ((Inspectable) mf).inspect().field("my_feature").asDouble());
     }
 
+    private static void checkCoverage(StreamingBackend searcher, String queryString, boolean degradedByMatchPhase) {
+        Result result = executeQuery(searcher, new Query(queryString));
+        assertNull(result.hits().getError());
+        assertEquals(degradedByMatchPhase, result.getCoverage(false).isDegradedByMatchPhase());
+    }
+
     @Test
     void testBasics() {
         MockVisitorFactory factory = new MockVisitorFactory();
@@ -263,6 +278,9 @@ public class StreamingSearcherTestCase {
         checkGrouping(searcher, "/?streaming.selection=true&query=onegroupinghit", 1);
 
         checkMatchFeatures(searcher);
+
+        checkCoverage(searcher, "/?streaming.userid=1&query=oneuserhit", false);
+        checkCoverage(searcher, "/?streaming.userid=1&query=earlyterminated", true);
     }
 
     @Test
@@ -65,3 +65,36 @@ TEST(ByteBuffer_Test, test_SerializableArray)
     EXPECT_EQ(0, strncmp(copy.get(0).c_str(), array.get(0).c_str(), 4));
     EXPECT_EQ(16ul, sizeof(SerializableArray::Entry));
 }
+
+TEST(ByteBuffer_Test, test_SerializableArray_lookup_with_many_entries)
+{
+    // Entries are laid out in the buffer in serialized order, which is not sorted by id.
+    std::string data;
+    SerializableArray::EntryMap entries;
+    for (uint32_t i = 0; i < 40; ++i) {
+        uint32_t id = (i * 7) % 40;
+        std::string value(1 + id % 5, char('a' + id % 26));
+        entries.emplace_back(id, value.size(), data.size());
+        data += value;
+    }
+    SerializableArray array;
+    array.set(std::move(entries), ByteBuffer::copyBuffer(data.data(), data.size()));
+    for (uint32_t id = 0; id < 40; ++id) {
+        std::string expected(1 + id % 5, char('a' + id % 26));
+        ASSERT_TRUE(array.has(id));
+        EXPECT_EQ(expected, std::string(array.get(id).c_str(), array.get(id).size()));
+    }
+    EXPECT_FALSE(array.has(40));
+    EXPECT_EQ(0u, array.get(-1).size());
+
+    SerializableArray copy(array);
+    EXPECT_EQ(std::string("hhh"), std::string(copy.get(7).c_str(), copy.get(7).size()));
+    array.set(7, "updated", 7);
+    array.set(100, "new", 3);
+    array.clear(3);
+    EXPECT_EQ(std::string("updated"), std::string(array.get(7).c_str(), array.get(7).size()));
+    EXPECT_EQ(std::string("new"), std::string(array.get(100).c_str(), array.get(100).size()));
+    EXPECT_FALSE(array.has(3));
+    EXPECT_TRUE(array.has(39));
+    EXPECT_EQ(std::string("hhh"), std::string(copy.get(7).c_str(), copy.get(7).size()));
+}
@@ -15,20 +15,32 @@ namespace document {
 
 namespace serializablearray {
 
-using BufferMapT = vespalib::hash_map<int, ByteBuffer>;
-
-class BufferMap : public BufferMapT {
-public:
-    using BufferMapT::BufferMapT;
+using BufferMap = vespalib::hash_map<int, ByteBuffer>;
+
+/**
+ * State only needed by some arrays, kept behind a single pointer.
+ * Buffers set directly are owned here, and arrays with many entries get
+ * the entry positions sorted by id, so lookups do not scan all entries.
+ */
+struct Extra {
+    BufferMap             buffers;
+    std::vector<uint32_t> byId;
 };
 
 }
 
+namespace {
+
+constexpr size_t MIN_ENTRIES_FOR_INDEX = 16;
+
+}
+
 void
 SerializableArray::set(EntryMap entries, ByteBuffer buffer)
 {
     _entries = std::move(entries);
     _uncompSerData = std::move(buffer);
+    buildIndex();
 }
 
 SerializableArray::SerializableArray() = default;
@@ -53,13 +65,16 @@ SerializableArray::SerializableArray(const SerializableArray& rhs)
     : _entries(rhs._entries),
       _uncompSerData(rhs._uncompSerData)
 {
+    if (rhs._extra && !rhs._extra->byId.empty()) {
+        ensure(_extra).byId = rhs._extra->byId;
+    }
     for (size_t i(0); i < _entries.size(); i++) {
         Entry & e(_entries[i]);
         if (e.hasBuffer()) {
-            // Pointing to a buffer in the _owned structure.
+            // Pointing to a buffer in the _extra structure.
             ByteBuffer buf(ByteBuffer::copyBuffer(e.getBuffer(&_uncompSerData), e.size()));
             e.setBuffer(buf.getBuffer());
-            ensure(_owned)[e.id()] = std::move(buf);
+            ensure(_extra).buffers[e.id()] = std::move(buf);
         } else {
             // If not it is relative to the buffer _uncompSerData, and hence it is valid as is.
         }
@@ -79,6 +94,7 @@ void SerializableArray::clear()
 {
     _entries.clear();
     _uncompSerData = ByteBuffer(nullptr, 0);
+    dropIndex();
 }
 
 void
@@ -86,9 +102,11 @@ SerializableArray::set(int id, ByteBuffer buffer)
 {
     Entry e(id, buffer.getRemaining(), buffer.getBuffer());
     assert(buffer.getRemaining() < 0x80000000ul);
-    ensure(_owned)[id] = std::move(buffer);
+    ensure(_extra).buffers[id] = std::move(buffer);
     auto it = find(id);
     if (it == _entries.end()) {
+        // Fields are typically set one by one, so do not rebuild the index for each of them.
+        dropIndex();
         _entries.push_back(e);
     } else {
         *it = e;
@@ -100,16 +118,46 @@ void SerializableArray::set(int id, const char* value, int len)
     set(id, ByteBuffer::copyBuffer(value,len));
 }
 
+void
+SerializableArray::buildIndex()
+{
+    if (_entries.size() < MIN_ENTRIES_FOR_INDEX) {
+        dropIndex();
+        return;
+    }
+    std::vector<uint32_t> & byId = ensure(_extra).byId;
+    byId.resize(_entries.size());
+    for (uint32_t i(0); i < byId.size(); i++) {
+        byId[i] = i;
+    }
+    // Stable, so the first of duplicate ids is found, as with a linear scan.
+    std::stable_sort(byId.begin(), byId.end(), [this](uint32_t a, uint32_t b) { return _entries[a].id() < _entries[b].id(); });
+}
+
+void
+SerializableArray::dropIndex()
+{
+    if (_extra) {
+        _extra->byId.clear();
+    }
+}
+
 SerializableArray::EntryMap::const_iterator
 SerializableArray::find(int id) const
 {
+    if (_extra && !_extra->byId.empty()) {
+        const std::vector<uint32_t> & byId = _extra->byId;
+        auto it = std::lower_bound(byId.begin(), byId.end(), id, [this](uint32_t pos, int key) { return _entries[pos].id() < key; });
+        return ((it != byId.end()) && (_entries[*it].id() == id)) ? (_entries.begin() + *it) : _entries.end();
+    }
     return std::find_if(_entries.begin(), _entries.end(), [id](const auto& e){ return e.id() == id; });
 }
 
 SerializableArray::EntryMap::iterator
 SerializableArray::find(int id)
 {
-    return std::find_if(_entries.begin(), _entries.end(), [id](const auto& e){ return e.id() == id; });
+    auto found = static_cast<const SerializableArray &>(*this).find(id);
+    return _entries.begin() + (found - _entries.cbegin());
 }
 
 bool
@@ -138,6 +186,7 @@ SerializableArray::clear(int id)
     auto it  = find(id);
     if (it != _entries.end()) {
         _entries.erase(it);
+        dropIndex();
     }
 }
 
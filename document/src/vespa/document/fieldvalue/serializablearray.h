@@ -23,7 +23,7 @@
 namespace document {
 
 namespace serializablearray {
-    class BufferMap;
+    struct Extra;
 }
 
 class SerializableArray
@@ -130,10 +130,12 @@ private:
     EntryMap                  _entries;
     /** Data we deserialized from, if applicable. */
     ByteBuffer                _uncompSerData;
-    std::unique_ptr<serializablearray::BufferMap> _owned;
+    std::unique_ptr<serializablearray::Extra> _extra;
 
     VESPA_DLL_LOCAL EntryMap::const_iterator find(int id) const;
     VESPA_DLL_LOCAL EntryMap::iterator find(int id);
+    VESPA_DLL_LOCAL void buildIndex();
+    VESPA_DLL_LOCAL void dropIndex();
 };
 
 } // document
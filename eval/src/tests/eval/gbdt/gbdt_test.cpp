@@ -410,6 +410,34 @@ TEST("require that fast forest evaluation is correct for all tree size categorie
     }
 }
 
+TEST("require that fast forest batch evaluation gives the same results as single evaluation") {
+    for (size_t tree_size: std::vector<size_t>({7,15,30,61,127})) {
+        std::string expression = Model().max_features(35).less_percent(100).invert_percent(50).make_forest(50, tree_size);
+        auto function = Function::parse(expression);
+        auto forest = FastForest::try_convert(*function);
+        if ((tree_size <= 64) || is_little_endian()) {
+            ASSERT_TRUE(forest);
+            TEST_STATE(forest->impl_name().c_str());
+            size_t num_params = function->num_params();
+            size_t num_docs = 37;
+            std::vector<float> params;
+            for (size_t i = 0; i < num_docs; ++i) {
+                for (size_t p = 0; p < num_params; ++p) {
+                    params.push_back(((i + p) % 5 == 0)
+                                     ? std::numeric_limits<float>::quiet_NaN()
+                                     : float((i * 7 + p * 3) % 11) / 10.0f);
+                }
+            }
+            auto ctx = forest->create_context();
+            std::vector<double> result(num_docs, 0.0);
+            forest->eval_batch(*ctx, &params[0], num_params, num_docs, &result[0]);
+            for (size_t i = 0; i < num_docs; ++i) {
+                EXPECT_EQUAL(forest->eval(*ctx, &params[i * num_params]), result[i]);
+            }
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 
 TEST("require that GDBT expressions can be detected") {
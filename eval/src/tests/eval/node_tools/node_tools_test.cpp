@@ -120,4 +120,27 @@ TEST("require that nested expressions can be copied") {
     TEST_DO(verify_copy("min(a,if(((b+3)==7),(!c),(d+7)))"));
 }
 
+TEST("require that parameters can be replaced while copying") {
+    auto fun = Function::parse({"a","b"}, "(a+b)*a");
+    auto inner = Function::parse({"x"}, "(x-1)");
+    auto resolve = [&](size_t id) -> nodes::Node_UP {
+        if (id == 0) {
+            return NodeTools::copy(inner->root(), [](size_t) { return std::make_unique<nodes::Symbol>(1); });
+        }
+        return std::make_unique<nodes::Symbol>(0);
+    };
+    auto fun_copy = Function::create(NodeTools::copy(fun->root(), resolve), {"b","x"});
+    EXPECT_EQUAL(fun_copy->dump(), "(((x-1)+b)*(x-1))");
+    EXPECT_EQUAL(fun->dump(), "((a+b)*a)");
+}
+
+TEST("require that failure to copy replacement gives nested error node") {
+    auto fun = Function::parse({"a"}, "(a+1)");
+    auto inner = Function::parse({"x"}, "reduce(x,sum)");
+    auto copy = NodeTools::copy(fun->root(), [&](size_t) { return NodeTools::copy(inner->root()); });
+    EXPECT_TRUE(nodes::as<nodes::Error>(*copy) == nullptr);
+    ASSERT_EQUAL(copy->num_children(), 2u);
+    EXPECT_TRUE(nodes::as<nodes::Error>(copy->get_child(0)) != nullptr);
+}
+
 TEST_MAIN() { TEST_RUN_ALL(); }
@@ -8,6 +8,7 @@
 #include <vespa/vespalib/util/benchmark_timer.h>
 #include <algorithm>
 #include <cassert>
+#include <limits>
 #include <arpa/inet.h>
 
 namespace vespalib::eval::gbdt {
@@ -143,10 +144,14 @@ template <> std::string fixed_impl_name<uint64_t>() { return "ff-fixed<64>"; }
 template <typename T>
 constexpr size_t max_leafs() { return (sizeof(T) * bits_per_byte); }
 
+// number of documents evaluated together during batch evaluation
+constexpr size_t batch_size = 16;
+
 template <typename T>
 struct FixedContext : FastForest::Context {
     std::vector<T> masks;
-    FixedContext(size_t num_trees) : masks(num_trees) {}
+    std::vector<T> batch_masks;
+    FixedContext(size_t num_trees) : masks(num_trees), batch_masks() {}
 };
 
 template <typename T>
@@ -195,11 +200,17 @@ struct FixedForest : FastForest {
     void init_state(T *ctx_masks) const;
     static void apply_masks(T *ctx_masks, const Mask *pos, const Mask *end, float limit);
     static void apply_masks(T *ctx_masks, const DMask *pos, const DMask *end);
-    double get_result(const T *ctx_masks) const;
+    static void apply_batch_masks(T *ctx_masks, const Mask *pos, const Mask *end, const float *limits, float max_limit);
+    static void apply_batch_masks(T *ctx_masks, const DMask *pos, const DMask *end, const float *limits);
+    double get_result(const T *ctx_masks, size_t stride = 1) const;
+    void eval_interleaved(T *ctx_masks, const float *params, size_t num_params,
+                          size_t num_docs, double *result) const;
 
     std::string impl_name() const override { return fixed_impl_name<T>(); }
     Context::UP create_context() const override;
     double eval(Context &context, const float *params) const override;
+    void eval_batch(Context &context, const float *params, size_t num_params,
+                    size_t num_docs, double *result) const override;
 };
 
 template <typename T>
@@ -285,27 +296,90 @@ FixedForest<T>::apply_masks(T *ctx_masks, const DMask *pos, const DMask *end)
     }
 }
 
+template <typename T>
+void
+FixedForest<T>::apply_batch_masks(T *ctx_masks, const Mask *pos, const Mask *end, const float *limits, float max_limit)
+{
+    // masks are stored per tree with one entry per document; branch
+    // free updates let the compiler vectorize the inner loop
+    for (; (pos < end) && !(max_limit < pos->value); ++pos) {
+        T *dst = ctx_masks + (pos->tree * batch_size);
+        T bits = pos->bits;
+        float value = pos->value;
+        for (size_t i = 0; i < batch_size; ++i) {
+            dst[i] &= (value <= limits[i]) ? bits : T(~T(0));
+        }
+    }
+}
+
+template <typename T>
+void
+FixedForest<T>::apply_batch_masks(T *ctx_masks, const DMask *pos, const DMask *end, const float *limits)
+{
+    for (; pos < end; ++pos) {
+        T *dst = ctx_masks + (pos->tree * batch_size);
+        T bits = pos->bits;
+        for (size_t i = 0; i < batch_size; ++i) {
+            dst[i] &= std::isnan(limits[i]) ? bits : T(~T(0));
+        }
+    }
+}
+
 template <typename T>
 double
-FixedForest<T>::get_result(const T *ctx_masks) const
+FixedForest<T>::get_result(const T *ctx_masks, size_t stride) const
 {
     double result1 = 0.0;
     double result2 = 0.0;
-    const T *ctx_end = (ctx_masks + _num_trees);
+    const T *ctx_end = (ctx_masks + (_num_trees * stride));
     const float *leafs = &_padded_leafs[0];
     size_t leaf_cnt = _max_leafs;
-    for (; (ctx_masks + 3) < ctx_end; ctx_masks += 4, leafs += (leaf_cnt * 4)) {
-        result1 += leafs[(0 * leaf_cnt) + get_lsb(ctx_masks[0])];
-        result2 += leafs[(1 * leaf_cnt) + get_lsb(ctx_masks[1])];
-        result1 += leafs[(2 * leaf_cnt) + get_lsb(ctx_masks[2])];
-        result2 += leafs[(3 * leaf_cnt) + get_lsb(ctx_masks[3])];
+    for (; (ctx_masks + (3 * stride)) < ctx_end; ctx_masks += (4 * stride), leafs += (leaf_cnt * 4)) {
+        result1 += leafs[(0 * leaf_cnt) + get_lsb(ctx_masks[0 * stride])];
+        result2 += leafs[(1 * leaf_cnt) + get_lsb(ctx_masks[1 * stride])];
+        result1 += leafs[(2 * leaf_cnt) + get_lsb(ctx_masks[2 * stride])];
+        result2 += leafs[(3 * leaf_cnt) + get_lsb(ctx_masks[3 * stride])];
     }
-    for (; ctx_masks < ctx_end; ++ctx_masks, leafs += leaf_cnt) {
+    for (; ctx_masks < ctx_end; ctx_masks += stride, leafs += leaf_cnt) {
         result1 += leafs[get_lsb(*ctx_masks)];
     }
     return (result1 + result2);
 }
 
+template <typename T>
+void
+FixedForest<T>::eval_interleaved(T *ctx_masks, const float *params, size_t num_params,
+                                 size_t num_docs, double *result) const
+{
+    assert(num_docs <= batch_size);
+    memset(ctx_masks, 0xff, _num_trees * batch_size * sizeof(T));
+    const Mask *mask_pos = &_masks[0];
+    float limits[batch_size];
+    for (size_t p = 0; p < _mask_sizes.size(); ++p) {
+        uint32_t size = _mask_sizes[p];
+        float max_limit = -std::numeric_limits<float>::infinity();
+        bool has_nan = false;
+        for (size_t i = 0; i < batch_size; ++i) {
+            // unused slots will not match any mask
+            limits[i] = (i < num_docs) ? params[(i * num_params) + p] : -std::numeric_limits<float>::infinity();
+            if (std::isnan(limits[i])) {
+                has_nan = true;
+            } else {
+                max_limit = std::max(max_limit, limits[i]);
+            }
+        }
+        apply_batch_masks(ctx_masks, mask_pos, mask_pos + size, limits, max_limit);
+        if (has_nan) {
+            apply_batch_masks(ctx_masks, &_default_masks[_default_offsets[p]],
+                              &_default_masks[_default_offsets[p + 1]], limits);
+        }
+        mask_pos += size;
+    }
+    for (size_t i = 0; i < num_docs; ++i) {
+        result[i] = get_result(ctx_masks + i, batch_size);
+    }
+}
+
 template <typename T>
 FastForest::Context::UP
 FixedForest<T>::create_context() const
@@ -335,6 +409,19 @@ FixedForest<T>::eval(Context &context, const float *params) const
     return get_result(ctx_masks);
 }
 
+template <typename T>
+void
+FixedForest<T>::eval_batch(Context &context, const float *params, size_t num_params,
+                           size_t num_docs, double *result) const
+{
+    auto &ctx = static_cast<FixedContext<T>&>(context);
+    ctx.batch_masks.resize(_num_trees * batch_size);
+    for (size_t offset = 0; offset < num_docs; offset += batch_size) {
+        size_t n = std::min(batch_size, num_docs - offset);
+        eval_interleaved(ctx.batch_masks.data(), params + (offset * num_params), num_params, n, result + offset);
+    }
+}
+
 //-----------------------------------------------------------------------------
 // implementation using multiple words for each tree
 //-----------------------------------------------------------------------------
@@ -661,6 +748,15 @@ FastForest::try_convert(const Function &fun, size_t min_fixed, size_t max_fixed)
     return FastForest::UP();
 }
 
+void
+FastForest::eval_batch(Context &context, const float *params, size_t num_params,
+                       size_t num_docs, double *result) const
+{
+    for (size_t i = 0; i < num_docs; ++i) {
+        result[i] = eval(context, params + (i * num_params));
+    }
+}
+
 double
 FastForest::estimate_cost_us(const std::vector<double> &params, double budget) const
 {
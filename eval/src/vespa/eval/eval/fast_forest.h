@@ -36,6 +36,14 @@ public:
     virtual std::string impl_name() const = 0;
     virtual Context::UP create_context() const = 0;
     virtual double eval(Context &context, const float *params) const = 0;
+    /**
+     * Evaluate the forest for multiple documents. The parameters for
+     * each document are stored after each other in 'params', using
+     * 'num_params' values per document. The default implementation
+     * evaluates one document at a time.
+     **/
+    virtual void eval_batch(Context &context, const float *params, size_t num_params,
+                            size_t num_docs, double *result) const;
     double estimate_cost_us(const std::vector<double> &params, double budget = 5.0) const;
 };
 
@@ -23,8 +23,11 @@ struct CopyNode : NodeTraverser, NodeVisitor {
 
     std::unique_ptr<Error> error;
     std::vector<Node_UP> stack;
+    const NodeTools::ParamResolver *resolve_param;
 
-    CopyNode() : error(), stack() {}
+    CopyNode() : error(), stack(), resolve_param(nullptr) {}
+    explicit CopyNode(const NodeTools::ParamResolver &resolve_param_in)
+      : error(), stack(), resolve_param(&resolve_param_in) {}
     ~CopyNode() override;
 
     Node_UP result() {
@@ -91,7 +94,11 @@ struct CopyNode : NodeTraverser, NodeVisitor {
         stack.push_back(std::make_unique<Number>(node.value()));
     }
     void visit(const Symbol &node) override {
-        stack.push_back(std::make_unique<Symbol>(node.id()));
+        if (resolve_param != nullptr) {
+            stack.push_back((*resolve_param)(node.id()));
+        } else {
+            stack.push_back(std::make_unique<Symbol>(node.id()));
+        }
     }
     void visit(const String &node) override {
         stack.push_back(std::make_unique<String>(node.value()));
@@ -210,4 +217,12 @@ NodeTools::copy(const Node &node)
     return copy_node.result();
 }
 
+Node_UP
+NodeTools::copy(const Node &node, const ParamResolver &resolve_param)
+{
+    CopyNode copy_node(resolve_param);
+    node.traverse(copy_node);
+    return copy_node.result();
+}
+
 } // namespace vespalib::eval
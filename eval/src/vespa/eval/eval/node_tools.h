@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 
 namespace vespalib::eval {
@@ -11,6 +12,9 @@ namespace nodes { struct Node; }
 struct NodeTools {
     static size_t min_num_params(const nodes::Node &node);
     static std::unique_ptr<nodes::Node> copy(const nodes::Node &node);
+    // copy node, letting 'resolve_param' create the replacement for each parameter
+    using ParamResolver = std::function<std::unique_ptr<nodes::Node>(size_t param_id)>;
+    static std::unique_ptr<nodes::Node> copy(const nodes::Node &node, const ParamResolver &resolve_param);
 };
 
 } // namespace vespalib::eval
@@ -6,6 +6,9 @@
 #include <vespa/fnet/ipacketstreamer.h>
 #include <vespa/fnet/connector.h>
 #include <vespa/fnet/connection.h>
+#include <vespa/vespalib/net/socket_address.h>
+#include <vespa/vespalib/net/socket_handle.h>
+#include <vespa/vespalib/net/socket_spec.h>
 #include <vespa/vespalib/util/size_literals.h>
 #include <vespa/vespalib/util/stringfmt.h>
 #include <thread>
@@ -29,7 +32,8 @@ struct Fixture {
     DummyAdapter adapter;
     FNET_Transport client;
     FNET_Transport server;
-    Fixture() : streamer(), adapter(), client(8), server(8)
+    explicit Fixture(bool reuse_port_listen = false)
+      : streamer(), adapter(), client(8), server(fnet::TransportConfig(8).reuse_port_listen(reuse_port_listen))
     {
         ASSERT_TRUE(client.Start());
         ASSERT_TRUE(server.Start());
@@ -50,6 +54,10 @@ struct Fixture {
     }
 };
 
+struct ReusePortFixture : Fixture {
+    ReusePortFixture() : Fixture(true) {}
+};
+
 void check_threads(FNET_Transport &transport, size_t num_threads, const std::string &tag) {
     std::set<FNET_TransportThread *> threads;
     while (threads.size() < num_threads) {
@@ -62,32 +70,55 @@ void check_threads(FNET_Transport &transport, size_t num_threads, const std::str
     }
 }
 
-TEST_F("require that connections are spread among transport threads", Fixture)
-{
-    FNET_Connector *listener = f1.server.Listen("tcp/0", &f1.streamer, &f1.adapter);
+void connect_and_check_spread(Fixture &f, size_t num_listeners) {
+    FNET_Connector *listener = f.server.Listen("tcp/0", &f.streamer, &f.adapter);
     ASSERT_TRUE(listener);
     uint32_t port = listener->GetPortNumber();
     std::string spec = vespalib::make_string("tcp/localhost:%u", port);
     std::vector<FNET_Connection *> connections;
     for (size_t i = 0; i < 256; ++i) {
         std::this_thread::sleep_for(1ms);
-        if (i > f1.server.GetNumIOComponents() + 16) {
+        if (i > f.server.GetNumIOComponents() + 16) {
             /*
              * tcp listen backlog is limited (cf. SOMAXCONN).
              * Slow down when getting too far ahead of server.
              */
             std::this_thread::sleep_for(10ms);
         }
-        connections.push_back(f1.client.Connect(spec.c_str(), &f1.streamer));
+        connections.push_back(f.client.Connect(spec.c_str(), &f.streamer));
         ASSERT_TRUE(connections.back());
     }
-    f1.wait_for_components(256, 257);    
-    check_threads(f1.client, 8, "client");
-    check_threads(f1.server, 8, "server");
+    f.wait_for_components(256, 256 + num_listeners);
+    check_threads(f.client, 8, "client");
+    check_threads(f.server, 8, "server");
     listener->internal_subref();
     for (FNET_Connection *conn: connections) {
         conn->internal_subref();
     }
 }
 
+TEST_F("require that connections are spread among transport threads", Fixture)
+{
+    connect_and_check_spread(f1, 1);
+}
+
+TEST_F("require that connections are spread among transport threads when listening with SO_REUSEPORT", ReusePortFixture)
+{
+    connect_and_check_spread(f1, 8);
+}
+
+TEST_F("require that closing a SO_REUSEPORT listener closes the listeners of all transport threads", ReusePortFixture)
+{
+    FNET_Connector *listener = f1.server.Listen("tcp/0", &f1.streamer, &f1.adapter);
+    ASSERT_TRUE(listener);
+    uint32_t port = listener->GetPortNumber();
+    f1.wait_for_components(0, 8);
+    FNET_Transport::Close(listener, false);
+    f1.wait_for_components(0, 0);
+    vespalib::SocketSpec spec(vespalib::make_string("tcp/localhost:%u", port));
+    for (size_t i = 0; i < 64; ++i) {
+        EXPECT_FALSE(spec.client_address().connect().valid());
+    }
+}
+
 TEST_MAIN() { TEST_RUN_ALL(); }
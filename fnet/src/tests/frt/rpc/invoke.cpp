@@ -4,6 +4,8 @@
 #include <vespa/vespalib/net/tls/statistics.h>
 #include <vespa/vespalib/util/benchmark_timer.h>
 #include <vespa/vespalib/util/latch.h>
+#include <vespa/vespalib/util/size_literals.h>
+#include <vespa/vespalib/util/stringfmt.h>
 #include <vespa/fnet/frt/supervisor.h>
 #include <vespa/fnet/frt/target.h>
 #include <vespa/fnet/frt/rpcrequest.h>
@@ -121,6 +123,14 @@ public:
             req->SetError(10000, "Streaming error");
         }
     }
+
+    void RPC_EchoAny(FRT_RPCRequest *req)
+    {
+        FNET_DataBuffer buf;
+
+        req->GetParams()->EncodeCopy(&buf);
+        req->GetReturn()->DecodeCopy(&buf, buf.GetDataLen());
+    }
 };
 
 EchoTest::~EchoTest() = default;
@@ -131,6 +141,7 @@ EchoTest::EchoTest(FRT_Supervisor *supervisor)
 {
     FRT_ReflectionBuilder rb(supervisor);
     rb.DefineMethod("echo", "*", "*", FRT_METHOD(EchoTest::RPC_Echo), this);
+    rb.DefineMethod("echoAny", "*", "*", FRT_METHOD(EchoTest::RPC_EchoAny), this);
 
     FRT_Values *args = &_echo_args;
     args->EnsureFree(16);
@@ -470,6 +481,23 @@ TEST_F("require that parameters can be echoed as return values", Fixture()) {
     EXPECT_TRUE(req.get().GetParams()->Equals(req.get().GetReturn()));
 }
 
+TEST_F("require that large packets can be echoed", Fixture()) {
+    for (size_t size : {size_t(100_Ki), size_t(1_Mi), size_t(5_Mi)}) {
+        TEST_STATE(vespalib::make_string("size: %zu", size).c_str());
+        std::string data(size, 'x');
+        for (size_t i = 0; i < size; i += 4_Ki) {
+            data[i] = char('a' + (i / 4_Ki) % 26);
+        }
+        MyReq req("echoAny");
+        req.get().GetParams()->AddData(data.data(), data.size());
+        f1.target().InvokeSync(req.borrow(), timeout);
+        ASSERT_TRUE(!req.get().IsError());
+        ASSERT_TRUE(req.get().CheckReturnTypes("x"));
+        const auto &ret = req.get().GetReturn()->GetValue(0)._data;
+        EXPECT_EQUAL(std::string_view(ret._buf, ret._len), std::string_view(data));
+    }
+}
+
 TEST_F("request denied by access filter returns PERMISSION_DENIED and does not invoke server method", Fixture()) {
     MyReq req("accessRestricted");
     auto key = MyAccessFilter::WRONG_KEY;
@@ -17,6 +17,7 @@ public:
     uint32_t  _maxOutputBufferSize;
     bool      _tcpNoDelay;
     bool      _drop_empty_buffers;
+    bool      _reuse_port_listen;
 
     FNET_Config();
 };
@@ -296,6 +296,16 @@ FNET_Connection::handle_packets()
     return !broken;
 }
 
+size_t
+FNET_Connection::read_chunk_size(size_t chunk_size) const
+{
+    if (_flags._gotheader && (_packetLength > _input.GetDataLen())) {
+        size_t remaining = std::min(size_t(_packetLength - _input.GetDataLen()), size_t(FNET_READ_PRESIZE_LIMIT));
+        return std::max(chunk_size, remaining);
+    }
+    return chunk_size;
+}
+
 bool
 FNET_Connection::Read()
 {
@@ -305,7 +315,7 @@ FNET_Connection::Read()
     int      my_errno    = 0;     // sample and preserve errno
     ssize_t  res;                 // single read result
 
-    _input.EnsureFree(chunk_size);
+    _input.EnsureFree(read_chunk_size(chunk_size));
     res = _socket->read(_input.GetFree(), _input.GetFreeLen());
     my_errno = errno;
     readCnt++;
@@ -317,7 +327,7 @@ FNET_Connection::Read()
         if (broken || ((_input.GetFreeLen() > 0) && !_flags._framed) || (readCnt >= FNET_READ_REDO)) {
             goto done_read;
         }
-        _input.EnsureFree(chunk_size);
+        _input.EnsureFree(read_chunk_size(chunk_size));
         res = _socket->read(_input.GetFree(), _input.GetFreeLen());
         my_errno = errno;
         readCnt++;
@@ -326,7 +336,7 @@ FNET_Connection::Read()
 done_read:
 
     while ((res > 0) && !broken) { // drain input pipeline
-        _input.EnsureFree(chunk_size);
+        _input.EnsureFree(read_chunk_size(chunk_size));
         res = _socket->drain(_input.GetFree(), _input.GetFreeLen());
         my_errno = errno;
         if (res > 0) {
@@ -42,7 +42,8 @@ public:
         FNET_READ_SIZE  = 16_Ki,
         FNET_READ_REDO  = 10,
         FNET_WRITE_SIZE = 16_Ki,
-        FNET_WRITE_REDO = 10
+        FNET_WRITE_REDO = 10,
+        FNET_READ_PRESIZE_LIMIT = 1_Mi
     };
 
 private:
@@ -198,6 +199,22 @@ private:
      **/
     bool handle_packets();
 
+    /**
+     * Calculate how much free space to ensure in the input buffer
+     * before the next read. When the header of a partially received
+     * packet is known, room is made for the rest of the packet, up
+     * to FNET_READ_PRESIZE_LIMIT. Packets up to the limit are thus
+     * read into a buffer that is resized at most once. Larger
+     * packets still grow the buffer by doubling as data arrives,
+     * since the packet length is not validated and a peer should not
+     * be able to make us allocate more than the limit ahead of the
+     * data it actually sends.
+     *
+     * @return number of bytes to ensure free in the input buffer
+     * @param chunk_size the default read chunk size
+     **/
+    size_t read_chunk_size(size_t chunk_size) const;
+
     /**
      * Read incoming data from socket.
      *
@@ -16,16 +16,43 @@ FNET_Connector::FNET_Connector(FNET_TransportThread *owner,
                                FNET_IPacketStreamer *streamer,
                                FNET_IServerAdapter *serverAdapter,
                                const char *spec,
-                               vespalib::ServerSocket server_socket)
+                               vespalib::ServerSocket server_socket,
+                               bool accept_locally)
     : FNET_IOComponent(owner, server_socket.get_fd(), spec, /* time-out = */ false),
       _streamer(streamer),
       _serverAdapter(serverAdapter),
       _server_socket(std::move(server_socket)),
-      _cached_port(_server_socket.address().port())
+      _cached_port(_server_socket.address().port()),
+      _accept_locally(accept_locally),
+      _shards_lock(),
+      _shards(),
+      _shards_closed(false)
 {
 }
 
 
+FNET_Connector::~FNET_Connector()
+{
+    for (FNET_Connector *shard : _shards) {
+        shard->internal_subref();
+    }
+}
+
+
+void
+FNET_Connector::add_shard(FNET_Connector *shard)
+{
+    {
+        std::lock_guard guard(_shards_lock);
+        if (!_shards_closed) {
+            _shards.push_back(shard);
+            return;
+        }
+    }
+    shard->Owner()->Close(shard, /* needRef = */ false);
+}
+
+
 uint32_t
 FNET_Connector::GetPortNumber() const {
     return _cached_port;
@@ -45,6 +72,15 @@ FNET_Connector::Close()
     detach_selector();
     _ioc_socket_fd = -1;
     _server_socket = vespalib::ServerSocket();
+    std::vector<FNET_Connector *> shards;
+    {
+        std::lock_guard guard(_shards_lock);
+        _shards_closed = true;
+        shards.swap(_shards);
+    }
+    for (FNET_Connector *shard : shards) {
+        shard->Owner()->Close(shard, /* needRef = */ false);
+    }
 }
 
 
@@ -53,8 +89,9 @@ FNET_Connector::HandleReadEvent()
 {
     SocketHandle handle = _server_socket.accept();
     if (handle.valid()) {
-        FNET_Transport &transport = Owner()->owner();
-        FNET_TransportThread *thread = transport.select_thread(&handle, sizeof(handle));
+        FNET_TransportThread *thread = _accept_locally
+                                       ? Owner()
+                                       : Owner()->owner().select_thread(&handle, sizeof(handle));
         if (thread->tune(handle)) {
             std::unique_ptr<FNET_Connection> conn = std::make_unique<FNET_Connection>(thread, _streamer, _serverAdapter, std::move(handle), GetSpec());
             if (conn->Init()) {
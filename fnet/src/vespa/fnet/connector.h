@@ -4,6 +4,8 @@
 
 #include "iocomponent.h"
 #include <vespa/vespalib/net/server_socket.h>
+#include <mutex>
+#include <vector>
 
 class FNET_IPacketStreamer;
 class FNET_IServerAdapter;
@@ -19,6 +21,10 @@ private:
     FNET_IServerAdapter   *_serverAdapter;
     vespalib::ServerSocket _server_socket;
     uint32_t _cached_port;
+    bool     _accept_locally;
+    std::mutex                    _shards_lock;
+    std::vector<FNET_Connector *> _shards;
+    bool                          _shards_closed;
 
     FNET_Connector(const FNET_Connector &);
     FNET_Connector &operator=(const FNET_Connector &);
@@ -32,12 +38,26 @@ public:
      * @param serverAdapter object for custom channel creation
      * @param spec listen spec for this connector
      * @param server_socket the underlying server socket
+     * @param accept_locally keep accepted connections in the owner
+     *        thread instead of selecting a transport thread for them
      **/
     FNET_Connector(FNET_TransportThread *owner,
                    FNET_IPacketStreamer *streamer,
                    FNET_IServerAdapter *serverAdapter,
                    const char *spec,
-                   vespalib::ServerSocket server_socket);
+                   vespalib::ServerSocket server_socket,
+                   bool accept_locally = false);
+    ~FNET_Connector() override;
+
+    /**
+     * Let this connector own another connector listening on the same
+     * port with SO_REUSEPORT in another transport thread. The shard
+     * is closed when this connector is closed, or right away if it
+     * already is. This method takes over a reference to the shard.
+     *
+     * @param shard connector listening on the same port
+     **/
+    void add_shard(FNET_Connector *shard);
 
     /**
      * Obtain the port number of the underlying server socket.
@@ -49,9 +69,10 @@ public:
     FNET_IServerAdapter *server_adapter() override;
 
     /**
-     * Close this connector. This method must be called in the transport
-     * thread in order to avoid race conditions related to socket event
-     * registration, deregistration and triggering.
+     * Close this connector and any shards owned by it. This method must
+     * be called in the transport thread in order to avoid race
+     * conditions related to socket event registration, deregistration
+     * and triggering.
      **/
     void Close() override;
 
@@ -3,6 +3,8 @@
 #include "transport.h"
 #include "transport_thread.h"
 #include "iocomponent.h"
+#include "connector.h"
+#include <vespa/vespalib/net/socket_spec.h>
 #include <vespa/vespalib/util/threadstackexecutor.h>
 #include <vespa/vespalib/util/size_literals.h>
 #include <vespa/vespalib/util/rendezvous.h>
@@ -196,7 +198,26 @@ FNET_Connector *
 FNET_Transport::Listen(const char *spec, FNET_IPacketStreamer *streamer,
                        FNET_IServerAdapter *serverAdapter)
 {
-    return select_thread(spec, strlen(spec))->Listen(spec, streamer, serverAdapter);
+    vespalib::SocketSpec socket_spec(spec);
+    bool reuse_port = (_config._reuse_port_listen && (_threads.size() > 1) && (socket_spec.port() >= 0));
+    if (!reuse_port) {
+        return select_thread(spec, strlen(spec))->Listen(spec, streamer, serverAdapter);
+    }
+    FNET_Connector *connector = _threads[0]->Listen(spec, streamer, serverAdapter, true);
+    if (connector == nullptr) {
+        return nullptr;
+    }
+    // All listeners must bind the same port, also when the given spec asks for any port.
+    std::string shard_spec = socket_spec.replace_port(connector->GetPortNumber()).spec();
+    for (size_t i = 1; i < _threads.size(); ++i) {
+        FNET_Connector *shard = _threads[i]->Listen(shard_spec.c_str(), streamer, serverAdapter, true);
+        if (shard != nullptr) {
+            connector->add_shard(shard); // closed together with the returned connector
+        } else {
+            LOG(warning, "could not add SO_REUSEPORT listener '%s' to transport thread %zu", shard_spec.c_str(), i);
+        }
+    }
+    return connector;
 }
 
 FNET_Connection *
@@ -84,6 +84,16 @@ public:
         _config._drop_empty_buffers = v;
         return *this;
     }
+    /**
+     * Let each transport thread listen on tcp ports with its own
+     * SO_REUSEPORT socket. The kernel spreads incoming connections
+     * among the threads, and each connection stays on the thread that
+     * accepted it.
+     **/
+    TransportConfig &reuse_port_listen(bool v) {
+        _config._reuse_port_listen = v;
+        return *this;
+    }
 
 private:
     FNET_Config                 _config;
@@ -206,6 +216,11 @@ public:
      * may supply a hostname as well, like this:
      * 'tcp/mycomputer.mydomain:8001'.
      *
+     * When reuse_port_listen is configured, tcp listeners are also
+     * added to all other transport threads. Only the connector of the
+     * first thread is returned. It owns the other listeners, and
+     * closing it closes all of them.
+     *
      * @return the connector object, or nullptr if listen failed.
      * @param spec string specifying how and where to listen.
      * @param streamer custom packet streamer.
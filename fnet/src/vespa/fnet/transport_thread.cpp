@@ -283,11 +283,11 @@ FNET_TransportThread::tune(SocketHandle &handle) const
 
 FNET_Connector*
 FNET_TransportThread::Listen(const char *spec, FNET_IPacketStreamer *streamer,
-                             FNET_IServerAdapter *serverAdapter)
+                             FNET_IServerAdapter *serverAdapter, bool reuse_port)
 {
-    ServerSocket server_socket{SocketSpec(spec)};
+    ServerSocket server_socket(SocketSpec(spec), reuse_port);
     if (server_socket.valid() && server_socket.set_blocking(false)) {
-        FNET_Connector *connector = new FNET_Connector(this, streamer, serverAdapter, spec, std::move(server_socket));
+        FNET_Connector *connector = new FNET_Connector(this, streamer, serverAdapter, spec, std::move(server_socket), reuse_port);
         connector->EnableReadEvent(true);
         connector->internal_addref();
         Add(connector, /* needRef = */ false);
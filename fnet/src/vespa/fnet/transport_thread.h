@@ -227,9 +227,11 @@ public:
      * @param spec string specifying how and where to listen.
      * @param streamer custom packet streamer.
      * @param serverAdapter object for custom channel creation.
+     * @param reuse_port listen with SO_REUSEPORT and keep accepted
+     *        connections in this thread.
      **/
     FNET_Connector *Listen(const char *spec, FNET_IPacketStreamer *streamer,
-                           FNET_IServerAdapter *serverAdapter);
+                           FNET_IServerAdapter *serverAdapter, bool reuse_port = false);
 
 
     /**
@@ -356,4 +356,122 @@ TEST(DocidRangeSchedulerTest, require_that_the_adaptive_scheduler_handles_fewer_
 
 //-----------------------------------------------------------------------------
 
+TEST(DocidRangeSchedulerTest, require_that_the_work_stealing_scheduler_starts_by_dividing_the_docid_space_equally)
+{
+    WorkStealingDocidRangeScheduler scheduler(4, 2, 16);
+    EXPECT_EQ(scheduler.task_size(), 2u);
+    EXPECT_EQ(scheduler.unassigned_size(), 15u);
+    EXPECT_EQ(scheduler.total_size(0), 0u);
+    verify_range("first0", scheduler.first_range(0), DocidRange(1, 3));
+    verify_range("first1", scheduler.first_range(1), DocidRange(5, 7));
+    verify_range("first2", scheduler.first_range(2), DocidRange(9, 11));
+    verify_range("first3", scheduler.first_range(3), DocidRange(13, 15));
+    EXPECT_EQ(scheduler.total_size(0), 2u);
+    EXPECT_EQ(scheduler.total_size(3), 2u);
+    EXPECT_EQ(scheduler.unassigned_size(), 7u);
+}
+
+TEST(DocidRangeSchedulerTest, require_that_the_work_stealing_scheduler_task_size_depends_on_the_docid_space)
+{
+    size_t num_tasks = 4 * WorkStealingDocidRangeScheduler::TASKS_PER_THREAD;
+    WorkStealingDocidRangeScheduler scheduler(4, 1, 1 + 100 * num_tasks);
+    EXPECT_EQ(scheduler.task_size(), 100u);
+    verify_range("first0", scheduler.first_range(0), DocidRange(1, 101));
+}
+
+TEST(DocidRangeSchedulerTest, require_that_the_work_stealing_scheduler_steals_the_back_half_of_the_largest_range)
+{
+    WorkStealingDocidRangeScheduler scheduler(2, 4, 21);
+    verify_range("first0", scheduler.first_range(0), DocidRange(1, 5));
+    verify_range("1st next0", scheduler.next_range(0), DocidRange(5, 9));
+    verify_range("2nd next0", scheduler.next_range(0), DocidRange(9, 11));
+    // steals [16,21) from thread 1
+    verify_range("3rd next0", scheduler.next_range(0), DocidRange(16, 20));
+    verify_range("4th next0", scheduler.next_range(0), DocidRange(20, 21));
+    // steals [13,16) from thread 1
+    verify_range("5th next0", scheduler.next_range(0), DocidRange(13, 16));
+    // a range not larger than a single task is not stolen
+    EXPECT_EQ(scheduler.unassigned_size(), 2u);
+    verify_range("6th next0", scheduler.next_range(0), DocidRange());
+    verify_range("first1", scheduler.first_range(1), DocidRange(11, 13));
+    verify_range("next1", scheduler.next_range(1), DocidRange());
+    EXPECT_EQ(scheduler.total_size(0), 18u);
+    EXPECT_EQ(scheduler.total_size(1), 2u);
+    EXPECT_EQ(scheduler.unassigned_size(), 0u);
+}
+
+TEST(DocidRangeSchedulerTest, require_that_the_work_stealing_scheduler_protects_against_documents_underflow)
+{
+    WorkStealingDocidRangeScheduler scheduler(2, 1, 0);
+    EXPECT_EQ(scheduler.unassigned_size(), 0u);
+    verify_range("first0", scheduler.first_range(0), DocidRange());
+    verify_range("first1", scheduler.first_range(1), DocidRange());
+    EXPECT_EQ(scheduler.total_size(0), 0u);
+    EXPECT_EQ(scheduler.total_size(1), 0u);
+}
+
+TEST(DocidRangeSchedulerTest, require_that_the_work_stealing_scheduler_handles_fewer_documents_than_threads)
+{
+    constexpr size_t num_threads = 4;
+    WorkStealingDocidRangeScheduler f1(num_threads, 1, 3);
+    TimeBomb f2(60);
+    auto task = [&f1](Nexus& ctx) {
+        auto thread_id = ctx.thread_id();
+        for (DocidRange docid_range = f1.first_range(thread_id);
+             !docid_range.empty();
+             docid_range = f1.next_range(thread_id))
+        {
+            EXPECT_EQ(1, docid_range.size());
+            EXPECT_GT(2, thread_id);
+        }
+    };
+    Nexus::run(num_threads, task);
+}
+
+TEST(DocidRangeSchedulerTest, require_that_the_work_stealing_scheduler_assigns_each_docid_exactly_once)
+{
+    constexpr size_t num_threads = 8;
+    constexpr uint32_t docid_limit = 100000;
+    WorkStealingDocidRangeScheduler f1(num_threads, 1, docid_limit);
+    std::vector<std::vector<DocidRange>> ranges(num_threads);
+    std::latch others_done(num_threads - 1);
+    TimeBomb f2(60);
+    auto task = [&](Nexus& ctx) {
+        auto thread_id = ctx.thread_id();
+        if (thread_id == 0) {
+            // everything but a single task should be stolen from a late thread
+            others_done.wait();
+        }
+        for (DocidRange docid_range = f1.first_range(thread_id);
+             !docid_range.empty();
+             docid_range = f1.next_range(thread_id))
+        {
+            ranges[thread_id].push_back(docid_range);
+        }
+        if (thread_id != 0) {
+            others_done.count_down();
+        }
+    };
+    Nexus::run(num_threads, task);
+    EXPECT_LE(f1.total_size(0), f1.task_size());
+    std::vector<uint32_t> seen(docid_limit, 0);
+    for (size_t i = 0; i < num_threads; ++i) {
+        size_t total = 0;
+        for (DocidRange range: ranges[i]) {
+            for (uint32_t docid = range.begin; docid < range.end; ++docid) {
+                ++seen[docid];
+            }
+            total += range.size();
+        }
+        EXPECT_EQ(total, f1.total_size(i));
+    }
+    EXPECT_EQ(seen[0], 0u);
+    for (uint32_t docid = 1; docid < docid_limit; ++docid) {
+        ASSERT_EQ(seen[docid], 1u) << "docid " << docid;
+    }
+    EXPECT_EQ(f1.unassigned_size(), 0u);
+}
+
+//-----------------------------------------------------------------------------
+
 GTEST_MAIN_RUN_ALL_TESTS()
@@ -330,4 +330,34 @@ TEST(MatchLoopCommunicatorTest, require_that_before_second_phase_is_called_once)
     EXPECT_EQ(1, cnt.load(std::memory_order_acquire));
 }
 
+TEST(MatchLoopCommunicatorTest, require_that_prefetch_is_told_about_the_best_hits_once)
+{
+    constexpr size_t num_threads = 5;
+    std::vector<std::vector<uint32_t>> calls;
+    auto prefetch = [&calls](std::span<const uint32_t> docids) { calls.emplace_back(docids.begin(), docids.end()); };
+    MatchLoopCommunicator f1(num_threads, 13, {}, nullptr, do_nothing, 7, prefetch);
+    auto task = [&f1](Nexus& ctx) {
+                    auto thread_id = ctx.thread_id();
+                    (void) second_phase(f1, makeScores(thread_id), thread_id);
+                };
+    Nexus::run(num_threads, task);
+    ASSERT_EQ(1u, calls.size());
+    EXPECT_EQ(std::vector<uint32_t>({1, 11, 21, 31, 41, 2, 12}), calls[0]);
+}
+
+TEST(MatchLoopCommunicatorTest, require_that_prefetch_is_limited_by_hits_selected_for_second_phase)
+{
+    constexpr size_t num_threads = 2;
+    std::vector<std::vector<uint32_t>> calls;
+    auto prefetch = [&calls](std::span<const uint32_t> docids) { calls.emplace_back(docids.begin(), docids.end()); };
+    MatchLoopCommunicator f1(num_threads, 3, {}, nullptr, do_nothing, 10, prefetch);
+    auto task = [&f1](Nexus& ctx) {
+                    auto thread_id = ctx.thread_id();
+                    (void) second_phase(f1, makeScores(thread_id), thread_id);
+                };
+    Nexus::run(num_threads, task);
+    ASSERT_EQ(1u, calls.size());
+    EXPECT_EQ(std::vector<uint32_t>({1, 11, 2}), calls[0]);
+}
+
 GTEST_MAIN_RUN_ALL_TESTS()
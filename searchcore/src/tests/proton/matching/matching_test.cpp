@@ -18,6 +18,7 @@
 #include <vespa/searchlib/engine/docsumrequest.h>
 #include <vespa/searchlib/engine/searchreply.h>
 #include <vespa/searchlib/engine/searchrequest.h>
+#include <vespa/searchlib/expression/aggregationrefnode.h>
 #include <vespa/searchlib/fef/i_ranking_assets_repo.h>
 #include <vespa/searchlib/fef/indexproperties.h>
 #include <vespa/searchlib/fef/properties.h>
@@ -451,7 +452,7 @@ struct MyWorld {
         vespalib::LimitedThreadBundleWrapper threadBundle(shared_state.thread_bundle(), threads);
         SearchReply::UP reply = matcher->match(req, threadBundle, searchContext, attributeContext,
                                                *sessionManager, metaStore, metaStore.getBucketDB(),
-                                               std::move(owned_objects));
+                                               std::move(owned_objects), nullptr);
         matchingStats.add(matcher->getStats());
         return reply;
     }
@@ -608,6 +609,24 @@ TEST_F(MatchingTest, require_that_matching_is_performed_with_multi_threaded_matc
     }
 }
 
+TEST_F(MatchingTest, require_that_block_scoring_gives_the_same_hits_as_scoring_each_document)
+{
+    MyWorld world(shared_state());
+    world.basicSetup();
+    world.basicResults();
+    SearchRequest::SP request = MyWorld::createSimpleRequest("f1", "spread");
+    SearchReply::UP expect = world.performSearch(*request, 1);
+    request->propertiesMap.lookupCreate(MapNames::RANK).add(BlockScoring::NAME, "true");
+    for (size_t threads = 1; threads <= 4; ++threads) {
+        SearchReply::UP reply = world.performSearch(*request, threads);
+        ASSERT_EQ(expect->hits.size(), reply->hits.size());
+        for (size_t i = 0; i < expect->hits.size(); ++i) {
+            EXPECT_EQ(expect->hits[i].gid, reply->hits[i].gid);
+            EXPECT_EQ(expect->hits[i].metric, reply->hits[i].metric);
+        }
+    }
+}
+
 TEST_F(MatchingTest, require_that_match_features_are_calculated_with_multi_threaded_matcher)
 {
     for (size_t threads = 1; threads <= 16; ++threads) {
@@ -854,6 +873,34 @@ TEST_F(MatchingTest, require_that_grouping_is_performed_with_multi_threaded_matc
     }
 }
 
+TEST_F(MatchingTest, require_that_approximate_grouping_is_traced)
+{
+    MyWorld world(shared_state());
+    world.basicSetup();
+    world.basicResults();
+    SearchRequest::SP request = MyWorld::createSimpleRequest("f1", "spread");
+    request->propertiesMap.lookupCreate(MapNames::RANK).add(indexproperties::grouping::ApproximationFactor::NAME, "2");
+    request->trace().setLevel(1);
+    {
+        vespalib::nbostream buf;
+        vespalib::NBOSerializer os(buf);
+        uint32_t n = 1;
+        os << n;
+        Grouping grequest;
+        grequest.setFirstLevel(0)
+                .setLastLevel(1)
+                .addLevel(std::move(GroupingLevel().setMaxGroups(1).setExpression(createAttr())
+                                    .addAggregationResult(std::make_unique<CountAggregationResult>())
+                                    .addOrderBy(std::make_unique<AggregationRefNode>(0), false)));
+        grequest.serialize(os);
+        request->groupSpec.assign(buf.data(), buf.data() + buf.size());
+    }
+    SearchReply::UP reply = world.performSearch(*request, 1);
+    EXPECT_EQ(9u, world.matchingStats.docsMatched());
+    // The 9 hits all have different a1 values, so each pruning loses a group counted once.
+    EXPECT_NE(std::string::npos, request->trace().toString().find("Grouping 0 level 0 is approximate"));
+}
+
 TEST_F(MatchingTest, require_that_summary_features_are_filled)
 {
     MyWorld world(shared_state());
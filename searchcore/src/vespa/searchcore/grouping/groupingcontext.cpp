@@ -62,13 +62,16 @@ GroupingContext::GroupingContext(const BitVector & validLids, const std::atomic<
     : _validLids(validLids),
       _now_ref(now_ref),
       _timeOfDoom(timeOfDoom),
+      _approximationFactor(0),
       _os(),
       _groupingList()
 { }
 
 GroupingContext::GroupingContext(const GroupingContext & rhs)
     : GroupingContext(rhs._validLids, rhs._now_ref, rhs._timeOfDoom)
-{ }
+{
+    _approximationFactor = rhs._approximationFactor;
+}
 
 void
 GroupingContext::addGrouping(std::shared_ptr<Grouping> g)
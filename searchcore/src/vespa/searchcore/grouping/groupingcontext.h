@@ -103,6 +103,12 @@ public:
      */
     steady_time getTimeOfDoom() const noexcept { return _timeOfDoom; }
     bool hasExpired() const noexcept { return _now_ref.load(std::memory_order_relaxed) > _timeOfDoom; }
+    /**
+     * Set the factor used for approximate top groups, applied to the groupings when they
+     * are initialized. This is a local setting that is not part of the serialized request.
+     */
+    void setApproximationFactor(uint32_t factor) noexcept { _approximationFactor = factor; }
+    uint32_t getApproximationFactor() const noexcept { return _approximationFactor; }
     /**
      * Figure out if ranking is necessary for any of the grouping requests here.
      * @return true if ranking is required.
@@ -121,6 +127,7 @@ private:
     const BitVector                & _validLids;
     const std::atomic<steady_time> & _now_ref;
     steady_time                      _timeOfDoom;
+    uint32_t                         _approximationFactor;
     vespalib::nbostream              _os;
     GroupingList                     _groupingList;
 };
@@ -49,6 +49,9 @@ GroupingManager::init(const IAttributeContext &attrCtx, const document::Document
                     an.enableEnumOptimization(true);
                 }
             }
+            if (_groupingContext.getApproximationFactor() > 0) {
+                grouping.setApproximationFactor(_groupingContext.getApproximationFactor());
+            }
             aggregation::NonAttribute2DocumentAccessor nonAttributes2DocumentAccess(attrCtx);
             ConfigureStaticParams stuff(&attrCtx, documentType);
             grouping.configureStaticStuff(stuff);
@@ -42,6 +42,9 @@ Memory TYPE("type");
 Memory MESSAGE("message");
 Memory TIMEOUT("timeout");
 
+// Number of stored documents fetched (and held in memory) ahead of producing their docsums.
+constexpr size_t PREFETCH_BATCH_SIZE = 64;
+
 }
 
 void
@@ -73,9 +76,14 @@ DocsumContext::createSlimeReply()
     Cursor & array = root.setArray(DOCSUMS);
     const Symbol docsumSym = response->insert(DOCSUM);
     _docsumState._omit_summary_features = (rci.res_class == nullptr) || rci.res_class->omit_summary_features();
+    const bool prefetch = (rci.res_class != nullptr) && ! rci.all_fields_generated;
+    std::span<const uint32_t> docIds(_docsumState._docsumbuf);
     uint32_t num_ok(0);
-    for (uint32_t docId : _docsumState._docsumbuf) {
+    for (uint32_t docId : docIds) {
         if (_request.expired() ) { break; }
+        if (prefetch && ((num_ok % PREFETCH_BATCH_SIZE) == 0)) {
+            _docsumStore.prefetch(docIds.subspan(num_ok, std::min(PREFETCH_BATCH_SIZE, docIds.size() - num_ok)));
+        }
         Cursor &docSumC = array.addObject();
         ObjectSymbolInserter inserter(docSumC, docsumSym);
         if ((docId != search::endDocId) && rci.res_class != nullptr) {
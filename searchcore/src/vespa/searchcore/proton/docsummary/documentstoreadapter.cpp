@@ -6,7 +6,9 @@
 #include <vespa/document/fieldvalue/stringfieldvalue.h>
 #include <vespa/eval/eval/value_codec.h>
 #include <vespa/vespalib/objects/nbostream.h>
+#include <vespa/vespalib/stllike/hash_map.hpp>
 #include <vespa/document/fieldvalue/tensorfieldvalue.h>
+#include <algorithm>
 
 #include <vespa/log/log.h>
 LOG_SETUP(".proton.docsummary.documentstoreadapter");
@@ -16,11 +18,28 @@ using namespace search::docsummary;
 
 namespace proton {
 
+namespace {
+
+class PrefetchVisitor : public search::IDocumentVisitor {
+public:
+    using Prefetched = vespalib::hash_map<uint32_t, DocumentUP>;
+    explicit PrefetchVisitor(Prefetched & prefetched) : _prefetched(prefetched) { }
+    void visit(uint32_t lid, DocumentUP doc) override {
+        _prefetched[lid] = std::move(doc);
+    }
+    bool allowVisitCaching() const override { return false; }
+private:
+    Prefetched & _prefetched;
+};
+
+}
+
 DocumentStoreAdapter::
 DocumentStoreAdapter(const search::IDocumentStore & docStore,
                      const DocumentTypeRepo &repo)
     : _docStore(docStore),
-      _repo(repo)
+      _repo(repo),
+      _prefetched()
 {
 }
 
@@ -29,7 +48,13 @@ DocumentStoreAdapter::~DocumentStoreAdapter() = default;
 std::unique_ptr<const IDocsumStoreDocument>
 DocumentStoreAdapter::get_document(uint32_t docId)
 {
-    auto document = _docStore.read(docId, _repo);
+    search::IDocumentStore::DocumentUP document;
+    auto found = _prefetched.find(docId);
+    if (found != _prefetched.end() && found->second) {
+        document = std::move(found->second);
+    } else {
+        document = _docStore.read(docId, _repo);
+    }
     if ( ! document) {
         LOG(debug, "Did not find summary document for docId %u. Returning empty docsum", docId);
         return {};
@@ -38,4 +63,18 @@ DocumentStoreAdapter::get_document(uint32_t docId)
     return std::make_unique<DocsumStoreDocument>(std::move(document));
 }
 
+void
+DocumentStoreAdapter::prefetch(std::span<const uint32_t> docIds)
+{
+    _prefetched.clear();
+    search::IDocumentStore::LidVector lids(docIds.begin(), docIds.end());
+    std::sort(lids.begin(), lids.end());
+    lids.erase(std::unique(lids.begin(), lids.end()), lids.end());
+    if (lids.size() < 2) {
+        return;
+    }
+    PrefetchVisitor visitor(_prefetched);
+    _docStore.readMany(lids, _repo, visitor);
+}
+
 } // namespace proton
@@ -4,6 +4,7 @@
 
 #include <vespa/searchsummary/docsummary/docsumstore.h>
 #include <vespa/searchlib/docstore/idocumentstore.h>
+#include <vespa/vespalib/stllike/hash_map.h>
 
 namespace proton {
 
@@ -12,6 +13,7 @@ class DocumentStoreAdapter : public search::docsummary::IDocsumStore
 private:
     const search::IDocumentStore           & _docStore;
     const document::DocumentTypeRepo       & _repo;
+    vespalib::hash_map<uint32_t, search::IDocumentStore::DocumentUP> _prefetched;
 
 public:
     DocumentStoreAdapter(const search::IDocumentStore &docStore,
@@ -19,6 +21,7 @@ public:
     ~DocumentStoreAdapter() override;
 
     std::unique_ptr<const search::docsummary::IDocsumStoreDocument> get_document(uint32_t docId) override;
+    void prefetch(std::span<const uint32_t> docIds) override;
 };
 
 } // namespace proton
@@ -36,6 +36,7 @@ public:
         virtual search::docsummary::IDocsumWriter &getDocsumWriter() const = 0;
         virtual const search::docsummary::ResultConfig &getResultConfig() = 0;
         virtual search::docsummary::IDocsumStore::UP createDocsumStore() = 0;
+        virtual const search::IDocumentStore &getDocumentStore() const = 0;
     };
 
     using UP = std::unique_ptr<ISummaryManager>;
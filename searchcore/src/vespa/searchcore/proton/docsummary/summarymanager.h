@@ -42,6 +42,7 @@ public:
         const search::docsummary::ResultConfig & getResultConfig() override { return *_docsumWriter->GetResultConfig(); }
 
         search::docsummary::IDocsumStore::UP createDocsumStore() override;
+        const search::IDocumentStore &getDocumentStore() const override { return *_docStore; }
 
         const search::IAttributeManager * getAttributeManager() const override { return _attributeMgr.get(); }
         const juniper::Juniper * getJuniper() const override { return _juniperConfig.get(); }
@@ -2,6 +2,7 @@
 
 #include "docid_range_scheduler.h"
 #include <cassert>
+#include <sched.h>
 
 namespace proton::matching {
 
@@ -9,6 +10,17 @@ namespace {
 
 size_t clamped_sub(size_t a, size_t b) { return (b > a) ? 0 : (a - b); }
 
+uint32_t current_numa_node() {
+#ifdef __linux__
+    unsigned int cpu = 0;
+    unsigned int node = 0;
+    if (getcpu(&cpu, &node) == 0) {
+        return node;
+    }
+#endif
+    return 0;
+}
+
 } // namespace proton::matching::<unnamed>
 
 const std::atomic<size_t> IdleObserver::_always_zero(0);
@@ -164,4 +176,111 @@ AdaptiveDocidRangeScheduler::share_range(size_t thread_id, DocidRange todo)
 
 //-----------------------------------------------------------------------------
 
+DocidRange
+WorkStealingDocidRangeScheduler::take(size_t thread_id)
+{
+    Worker &worker = _workers[thread_id];
+    uint64_t current = worker.range.load(std::memory_order_relaxed);
+    for (;;) {
+        DocidRange todo = unpack(current);
+        if (todo.empty()) {
+            return DocidRange();
+        }
+        uint32_t split = todo.begin + std::min(todo.size(), size_t(_task_size));
+        if (worker.range.compare_exchange_weak(current, pack(split, todo.end), std::memory_order_relaxed)) {
+            worker.assigned.store(worker.assigned.load(std::memory_order_relaxed) + (split - todo.begin),
+                                  std::memory_order_relaxed);
+            return DocidRange(todo.begin, split);
+        }
+    }
+}
+
+bool
+WorkStealingDocidRangeScheduler::steal(size_t thread_id)
+{
+    Worker &self = _workers[thread_id];
+    uint32_t my_node = self.numa_node.load(std::memory_order_relaxed);
+    for (;;) {
+        // ranges not larger than a single task are left to their owner
+        size_t local_victim = _workers.size();
+        size_t local_size = _task_size;
+        size_t remote_victim = _workers.size();
+        size_t remote_size = _task_size;
+        for (size_t i = 0; i < _workers.size(); ++i) {
+            if (i == thread_id) {
+                continue;
+            }
+            size_t size = unpack(_workers[i].range.load(std::memory_order_relaxed)).size();
+            if (_workers[i].numa_node.load(std::memory_order_relaxed) == my_node) {
+                if (size > local_size) {
+                    local_victim = i;
+                    local_size = size;
+                }
+            } else if (size > remote_size) {
+                remote_victim = i;
+                remote_size = size;
+            }
+        }
+        size_t victim = (local_victim < _workers.size()) ? local_victim : remote_victim;
+        if (victim == _workers.size()) {
+            return false;
+        }
+        Worker &target = _workers[victim];
+        uint64_t current = target.range.load(std::memory_order_relaxed);
+        DocidRange todo = unpack(current);
+        if (todo.size() > _task_size) {
+            uint32_t mid = todo.begin + (todo.size() / 2);
+            // The begin of a non-empty range is only ever consumed by
+            // its owner, so a packed range value is never seen twice.
+            if (target.range.compare_exchange_strong(current, pack(todo.begin, mid), std::memory_order_relaxed)) {
+                self.range.store(pack(mid, todo.end), std::memory_order_relaxed);
+                return true;
+            }
+        }
+    }
+}
+
+WorkStealingDocidRangeScheduler::WorkStealingDocidRangeScheduler(size_t num_threads, uint32_t min_task, uint32_t docid_limit)
+    : _task_size(std::max(1u, min_task)),
+      _workers(num_threads)
+{
+    DocidRangeSplitter splitter(DocidRange(1, docid_limit), num_threads);
+    _task_size = std::max(_task_size, uint32_t(splitter.full_range().size() / (num_threads * TASKS_PER_THREAD)));
+    for (size_t i = 0; i < num_threads; ++i) {
+        DocidRange range = splitter.get(i);
+        _workers[i].range.store(pack(range.begin, range.end), std::memory_order_relaxed);
+    }
+}
+
+WorkStealingDocidRangeScheduler::~WorkStealingDocidRangeScheduler() = default;
+
+DocidRange
+WorkStealingDocidRangeScheduler::first_range(size_t thread_id)
+{
+    _workers[thread_id].numa_node.store(current_numa_node(), std::memory_order_relaxed);
+    return next_range(thread_id);
+}
+
+DocidRange
+WorkStealingDocidRangeScheduler::next_range(size_t thread_id)
+{
+    DocidRange range = take(thread_id);
+    while (range.empty() && steal(thread_id)) {
+        range = take(thread_id);
+    }
+    return range;
+}
+
+size_t
+WorkStealingDocidRangeScheduler::unassigned_size() const
+{
+    size_t sum = 0;
+    for (const auto &worker: _workers) {
+        sum += unpack(worker.range.load(std::memory_order_relaxed)).size();
+    }
+    return sum;
+}
+
+//-----------------------------------------------------------------------------
+
 }
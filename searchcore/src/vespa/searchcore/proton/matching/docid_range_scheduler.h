@@ -201,4 +201,46 @@ public:
     DocidRange share_range(size_t, DocidRange todo) override;
 };
 
+/**
+ * A lock-free scheduler that begins by giving each thread an equal
+ * part of the docid space. Each thread consumes its own part from the
+ * front in small tasks. A thread running out of work steals the back
+ * half of the largest remaining part of another thread, preferring
+ * threads that were started on the same NUMA node as itself.
+ **/
+class WorkStealingDocidRangeScheduler : public DocidRangeScheduler
+{
+private:
+    struct alignas(64) Worker {
+        std::atomic<uint64_t> range;    // [begin, end) packed as (begin << 32) | end
+        std::atomic<size_t>   assigned;
+        std::atomic<uint32_t> numa_node;
+        Worker() noexcept : range(0), assigned(0), numa_node(0) {}
+    };
+    static constexpr uint64_t pack(uint32_t begin, uint32_t end) noexcept {
+        return ((uint64_t(begin) << 32) | end);
+    }
+    static DocidRange unpack(uint64_t range) noexcept {
+        return DocidRange(uint32_t(range >> 32), uint32_t(range));
+    }
+    uint32_t            _task_size;
+    std::vector<Worker> _workers;
+
+    VESPA_DLL_LOCAL DocidRange take(size_t thread_id);
+    VESPA_DLL_LOCAL bool steal(size_t thread_id);
+public:
+    static constexpr size_t TASKS_PER_THREAD = 32;
+    WorkStealingDocidRangeScheduler(size_t num_threads, uint32_t min_task, uint32_t docid_limit);
+    ~WorkStealingDocidRangeScheduler() override;
+    DocidRange first_range(size_t thread_id) override;
+    DocidRange next_range(size_t thread_id) override;
+    size_t total_size(size_t thread_id) const override {
+        return _workers[thread_id].assigned.load(std::memory_order_relaxed);
+    }
+    size_t unassigned_size() const override;
+    IdleObserver make_idle_observer() const override { return IdleObserver(); }
+    DocidRange share_range(size_t, DocidRange todo) override { return todo; }
+    uint32_t task_size() const noexcept { return _task_size; }
+};
+
 }
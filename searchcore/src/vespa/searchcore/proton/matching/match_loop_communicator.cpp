@@ -11,11 +11,13 @@ namespace proton:: matching {
 MatchLoopCommunicator::MatchLoopCommunicator(size_t threads, size_t topN)
     : MatchLoopCommunicator(threads, topN, {}, nullptr, []() noexcept {})
 {}
-MatchLoopCommunicator::MatchLoopCommunicator(size_t threads, size_t topN, std::unique_ptr<IDiversifier> diversifier, FirstPhaseRankLookup* first_phase_rank_lookup, std::function<void()> before_second_phase)
+MatchLoopCommunicator::MatchLoopCommunicator(size_t threads, size_t topN, std::unique_ptr<IDiversifier> diversifier, FirstPhaseRankLookup* first_phase_rank_lookup, std::function<void()> before_second_phase,
+                                             size_t prefetch_count, Prefetch prefetch)
     : _best_scores(),
       _best_dropped(),
       _estimate_match_frequency(threads),
-      _get_second_phase_work(threads, topN, _best_scores, _best_dropped, std::move(diversifier), first_phase_rank_lookup, std::move(before_second_phase)),
+      _get_second_phase_work(threads, topN, _best_scores, _best_dropped, std::move(diversifier), first_phase_rank_lookup, std::move(before_second_phase),
+                             prefetch_count, std::move(prefetch)),
       _complete_second_phase(threads, topN, _best_scores, _best_dropped)
 {}
 MatchLoopCommunicator::~MatchLoopCommunicator() = default;
@@ -60,14 +62,16 @@ public:
 
 }
 
-MatchLoopCommunicator::GetSecondPhaseWork::GetSecondPhaseWork(size_t n, size_t topN_in, Range &best_scores_in, BestDropped &best_dropped_in, std::unique_ptr<IDiversifier> diversifier, FirstPhaseRankLookup* first_phase_rank_lookup, std::function<void()> before_second_phase)
+MatchLoopCommunicator::GetSecondPhaseWork::GetSecondPhaseWork(size_t n, size_t topN_in, Range &best_scores_in, BestDropped &best_dropped_in, std::unique_ptr<IDiversifier> diversifier, FirstPhaseRankLookup* first_phase_rank_lookup, std::function<void()> before_second_phase, size_t prefetch_count, Prefetch prefetch)
     : vespalib::Rendezvous<SortedHitSequence, TaggedHits, true>(n),
       topN(topN_in),
       best_scores(best_scores_in),
       best_dropped(best_dropped_in),
       _diversifier(std::move(diversifier)),
       _first_phase_rank_lookup(first_phase_rank_lookup),
-      _before_second_phase(std::move(before_second_phase))
+      _before_second_phase(std::move(before_second_phase)),
+      _prefetch_count(prefetch_count),
+      _prefetch(std::move(prefetch))
 {}
 
 MatchLoopCommunicator::GetSecondPhaseWork::~GetSecondPhaseWork() = default;
@@ -137,6 +141,28 @@ MatchLoopCommunicator::GetSecondPhaseWork::mingle()
     } else {
         mingle(queue, NoRegisterFirstPhaseRank());
     }
+    if (_prefetch && (_prefetch_count > 0)) {
+        prefetch_best();
+    }
+}
+
+void
+MatchLoopCommunicator::GetSecondPhaseWork::prefetch_best()
+{
+    // the picked hits were dealt out round-robin, best first
+    std::vector<uint32_t> docids;
+    docids.reserve(_prefetch_count);
+    for (size_t i = 0; i < _prefetch_count; ++i) {
+        const TaggedHits &work = out(i % size());
+        size_t idx = i / size();
+        if (idx >= work.size()) {
+            break;
+        }
+        docids.push_back(work[idx].first.first);
+    }
+    if (!docids.empty()) {
+        _prefetch(docids);
+    }
 }
 
 void
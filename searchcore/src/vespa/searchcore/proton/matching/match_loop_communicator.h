@@ -6,6 +6,7 @@
 #include <vespa/searchlib/queryeval/idiversifier.h>
 #include <vespa/vespalib/util/rendezvous.h>
 #include <functional>
+#include <span>
 
 namespace search::features { class FirstPhaseRankLookup; }
 
@@ -13,6 +14,14 @@ namespace proton::matching {
 
 class MatchLoopCommunicator final : public IMatchLoopCommunicator
 {
+public:
+    /**
+     * Told about the docids of the best hits selected for second phase
+     * ranking, best first phase score first, before second phase
+     * ranking starts. Called by a single thread while the others wait,
+     * so it should only start work that completes in the background.
+     **/
+    using Prefetch = std::function<void(std::span<const uint32_t> docids)>;
 private:
     using IDiversifier = search::queryeval::IDiversifier;
     using FirstPhaseRankLookup = search::features::FirstPhaseRankLookup;
@@ -31,9 +40,12 @@ private:
         std::unique_ptr<IDiversifier> _diversifier;
         FirstPhaseRankLookup* _first_phase_rank_lookup;
         std::function<void()> _before_second_phase;
-        GetSecondPhaseWork(size_t n, size_t topN_in, Range &best_scores_in, BestDropped &best_dropped_in, std::unique_ptr<IDiversifier> diversifier, FirstPhaseRankLookup* first_phase_rank_lookup, std::function<void()> before_second_phase);
+        size_t _prefetch_count;
+        Prefetch _prefetch;
+        GetSecondPhaseWork(size_t n, size_t topN_in, Range &best_scores_in, BestDropped &best_dropped_in, std::unique_ptr<IDiversifier> diversifier, FirstPhaseRankLookup* first_phase_rank_lookup, std::function<void()> before_second_phase, size_t prefetch_count, Prefetch prefetch);
         ~GetSecondPhaseWork() override;
         void mingle() override;
+        void prefetch_best();
         template<typename Q, typename R>
         void mingle(Q &queue, R register_first_phase_rank);
         template<typename Q, typename F, typename R>
@@ -67,7 +79,8 @@ private:
 
 public:
     MatchLoopCommunicator(size_t threads, size_t topN);
-    MatchLoopCommunicator(size_t threads, size_t topN, std::unique_ptr<IDiversifier>, FirstPhaseRankLookup* first_phase_rank_lookup, std::function<void()> before_second_phsae);
+    MatchLoopCommunicator(size_t threads, size_t topN, std::unique_ptr<IDiversifier>, FirstPhaseRankLookup* first_phase_rank_lookup, std::function<void()> before_second_phsae,
+                          size_t prefetch_count = 0, Prefetch prefetch = {});
     ~MatchLoopCommunicator();
 
     double estimate_match_frequency(const Matches &matches) override {
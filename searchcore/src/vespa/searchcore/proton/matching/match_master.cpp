@@ -7,6 +7,7 @@
 #include "match_tools.h"
 #include "extract_features.h"
 #include "partial_result.h"
+#include <vespa/searchlib/docstore/idocumentstore.h>
 #include <vespa/searchlib/engine/trace.h>
 #include <vespa/searchlib/engine/searchreply.h>
 #include <vespa/vespalib/util/thread_bundle.h>
@@ -48,8 +49,11 @@ struct TimedMatchLoopCommunicator final : IMatchLoopCommunicator {
 };
 
 DocidRangeScheduler::UP
-createScheduler(uint32_t numThreads, uint32_t numSearchPartitions, uint32_t numDocs)
+createScheduler(uint32_t numThreads, uint32_t numSearchPartitions, bool workStealing, uint32_t numDocs)
 {
+    if (workStealing) {
+        return std::make_unique<WorkStealingDocidRangeScheduler>(numThreads, 1, numDocs);
+    }
     if (numSearchPartitions == 0) {
         return std::make_unique<AdaptiveDocidRangeScheduler>(numThreads, 1, numDocs);
     }
@@ -82,7 +86,9 @@ MatchMaster::match(search::engine::Trace & trace,
                    const MatchToolsFactory &mtf,
                    ResultProcessor &resultProcessor,
                    uint32_t distributionKey,
-                   uint32_t numSearchPartitions)
+                   uint32_t numSearchPartitions,
+                   bool workStealing,
+                   const search::IDocumentStore *prefetchStore)
 {
     vespalib::Timer query_latency_time;
     vespalib::DualMergeDirector mergeDirector(threadBundle.size());
@@ -90,11 +96,19 @@ MatchMaster::match(search::engine::Trace & trace,
      * We need a non-const first phase rank lookup since it will be populated
      * later on when selecting documents for second phase ranking.
      */
+    MatchLoopCommunicator::Prefetch prefetch;
+    if (prefetchStore != nullptr) {
+        // overlap fetching documents for the likely top hits with second phase ranking
+        prefetch = [prefetchStore](std::span<const uint32_t> docids) {
+            prefetchStore->prefetch(search::IDocumentStore::LidVector(docids.begin(), docids.end()));
+        };
+    }
     MatchLoopCommunicator communicator(threadBundle.size(), params.heapSize, mtf.createDiversifier(params.diversity_want_hits),
                                        mtf.get_first_phase_rank_lookup(),
-                                       [&mtf]() noexcept { mtf.query().set_matching_phase(MatchingPhase::SECOND_PHASE); });
+                                       [&mtf]() noexcept { mtf.query().set_matching_phase(MatchingPhase::SECOND_PHASE); },
+                                       params.offset + params.hits, std::move(prefetch));
     TimedMatchLoopCommunicator timedCommunicator(communicator);
-    DocidRangeScheduler::UP scheduler = createScheduler(threadBundle.size(), numSearchPartitions, params.numDocs);
+    DocidRangeScheduler::UP scheduler = createScheduler(threadBundle.size(), numSearchPartitions, workStealing, params.numDocs);
 
     std::vector<MatchThread::UP> threadState;
     for (size_t i = 0; i < threadBundle.size(); ++i) {
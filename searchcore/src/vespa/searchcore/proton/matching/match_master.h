@@ -7,6 +7,7 @@
 
 namespace vespalib { struct ThreadBundle; }
 namespace search { class FeatureSet; }
+namespace search { class IDocumentStore; }
 namespace search::engine { class Trace; }
 
 namespace proton::matching {
@@ -30,7 +31,9 @@ public:
                                       const MatchToolsFactory &mtf,
                                       ResultProcessor &resultProcessor,
                                       uint32_t distributionKey,
-                                      uint32_t numSearchPartitions);
+                                      uint32_t numSearchPartitions,
+                                      bool workStealing,
+                                      const search::IDocumentStore *prefetchStore);
 
     static MatchingStats getStats(MatchMaster && rhs) { return std::move(rhs._stats); }
 };
@@ -24,7 +24,9 @@ MatchParams::MatchParams(uint32_t          numDocs_in,
                          uint32_t          offset_in,
                          uint32_t          hits_in,
                          bool              hasFinalRank,
-                         bool              needRanking)
+                         bool              needRanking,
+                         uint32_t          topk_batch_size_in,
+                         bool              block_scoring_in)
     : numDocs(numDocs_in),
       heapSize((hasFinalRank && needRanking) ? std::min(numDocs_in, heapSize_in) : 0),
       arraySize((needRanking && ((heapSize_in + arraySize_in) > 0))
@@ -33,6 +35,8 @@ MatchParams::MatchParams(uint32_t          numDocs_in,
       offset(std::min(numDocs_in, offset_in)),
       hits(std::min(numDocs_in - offset, hits_in)),
       diversity_want_hits(heapSize_in),
+      topk_batch_size(topk_batch_size_in),
+      block_scoring(block_scoring_in),
       first_phase_rank_score_drop_limit(first_phase_rank_score_drop_limit_in),
       second_phase_rank_score_drop_limit(second_phase_rank_score_drop_limit_in)
 { }
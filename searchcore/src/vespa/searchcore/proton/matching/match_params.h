@@ -19,6 +19,8 @@ struct MatchParams {
     const uint32_t          offset;
     const uint32_t          hits;
     const uint32_t          diversity_want_hits;
+    const uint32_t          topk_batch_size;
+    const bool              block_scoring;
     const std::optional<search::feature_t> first_phase_rank_score_drop_limit;
     const std::optional<search::feature_t> second_phase_rank_score_drop_limit;
 
@@ -30,7 +32,9 @@ struct MatchParams {
                 uint32_t          offset_in,
                 uint32_t          hits_in,
                 bool              hasFinalRank,
-                bool              needRanking);
+                bool              needRanking,
+                uint32_t          topk_batch_size_in = 0,
+                bool              block_scoring_in = false);
     bool save_rank_scores() const noexcept { return (arraySize != 0); }
 };
 
@@ -46,6 +46,9 @@ struct WaitTimer {
     }
 };
 
+// number of documents scored together when the first phase score supports block evaluation
+constexpr size_t rank_block_size = 64;
+
 // seek_next maps to SearchIterator::seekNext
 struct SimpleStrategy {
     static uint32_t seek_next(SearchIterator &search, uint32_t docid) {
@@ -100,21 +103,43 @@ fillPartialResult(ResultProcessor::Context & context, size_t totalHits, size_t n
 
 //-----------------------------------------------------------------------------
 
-MatchThread::Context::Context(std::optional<double> first_phase_rank_score_drop_limit, MatchTools &tools, HitCollector &hits, uint32_t num_threads)
+MatchThread::Context::Context(std::optional<double> first_phase_rank_score_drop_limit, bool block_scoring,
+                              MatchTools &tools, HitCollector &hits, uint32_t num_threads)
     : matches(0),
       _matches_limit(tools.match_limiter().sample_hits_per_thread(num_threads)),
       _score_feature(get_score_feature(tools.rank_program())),
       _first_phase_rank_score_drop_limit(first_phase_rank_score_drop_limit.value_or(0.0 /* ignored */)),
       _hits(hits),
       _doom(tools.getDoom()),
+      _block_size((block_scoring && _score_feature.supports_block()) ? rank_block_size : 0),
+      _block_docids(),
+      _block_scores(_block_size),
       dropped()
 {
+    _block_docids.reserve(_block_size);
 }
 
 template <MatchThread::RankDropLimitE use_rank_drop_limit>
 void
 MatchThread::Context::rankHit(uint32_t docId) {
-    double score = _score_feature.as_number(docId);
+    addScoredHit<use_rank_drop_limit>(docId, _score_feature.as_number(docId));
+}
+
+template <MatchThread::RankDropLimitE use_rank_drop_limit>
+void
+MatchThread::Context::rankBlock() {
+    std::span<const uint32_t> docids(_block_docids);
+    std::span<search::feature_t> scores(_block_scores.data(), docids.size());
+    _score_feature.as_numbers(docids, scores);
+    for (size_t i = 0; i < docids.size(); ++i) {
+        addScoredHit<use_rank_drop_limit>(docids[i], scores[i]);
+    }
+    _block_docids.clear();
+}
+
+template <MatchThread::RankDropLimitE use_rank_drop_limit>
+void
+MatchThread::Context::addScoredHit(uint32_t docId, double score) {
     // convert NaN and Inf scores to -Inf
     if (__builtin_expect(std::isnan(score) || std::isinf(score), false)) {
         score = -HUGE_VAL;
@@ -191,8 +216,14 @@ MatchThread::inner_match_loop(Context &context, MatchTools &tools, DocidRange &d
     uint32_t docId = search->seekFirst(docid_range.begin);
     while ((docId < docid_range.end) && !context.atSoftDoom()) {
         if (do_rank) {
+            // unpack even when the score does not use match data, since it may have side effects
+            // on the search (like raising the threshold of a wand search).
             search->unpack(docId);
-            context.rankHit<use_rank_drop_limit>(docId);
+            if (context.rankBlocks()) {
+                context.addToBlock<use_rank_drop_limit>(docId);
+            } else {
+                context.rankHit<use_rank_drop_limit>(docId);
+            }
         } else {
             context.addHit(docId);
         }
@@ -207,6 +238,9 @@ MatchThread::inner_match_loop(Context &context, MatchTools &tools, DocidRange &d
             docId = Strategy::seek_next(*search, docId + 1);
         }
     }
+    if (do_rank && context.rankBlocks()) {
+        context.rankBlock<use_rank_drop_limit>();
+    }
     return docId;
 }
 
@@ -218,7 +252,7 @@ MatchThread::match_loop(MatchTools &tools, HitCollector &hits)
     bool softDoomed = false;
     uint32_t docsCovered = 0;
     vespalib::duration overtime(vespalib::duration::zero());
-    Context context(matchParams.first_phase_rank_score_drop_limit, tools, hits, num_threads);
+    Context context(matchParams.first_phase_rank_score_drop_limit, matchParams.block_scoring, tools, hits, num_threads);
     for (DocidRange docid_range = scheduler.first_range(thread_id);
          !docid_range.empty();
          docid_range = scheduler.next_range(thread_id))
@@ -368,7 +402,7 @@ MatchThread::findMatches(MatchTools &tools)
         tools.give_back_search(ProfiledIterator::profile(*match_profiler, tools.borrow_search()));
         tools.tag_search_as_changed();
     }
-    HitCollector hits(matchParams.numDocs, match_with_ranking ? matchParams.arraySize : 0);
+    HitCollector hits(matchParams.numDocs, match_with_ranking ? matchParams.arraySize : 0, matchParams.topk_batch_size);
     trace->addEvent(4, "Start match and first phase rank");
     /**
      * All, or none of the threads in the bundle must execute the match loop.
@@ -73,10 +73,21 @@ private:
 
     class Context {
     public:
-        Context(std::optional<double> first_phase_rank_score_drop_limit, MatchTools &tools, HitCollector &hits,
-                uint32_t num_threads) __attribute__((noinline));
+        Context(std::optional<double> first_phase_rank_score_drop_limit, bool block_scoring, MatchTools &tools,
+                HitCollector &hits, uint32_t num_threads) __attribute__((noinline));
         template <RankDropLimitE use_rank_drop_limit>
         void rankHit(uint32_t docId);
+        // used when enabled and the score can be calculated for blocks of documents without match data
+        bool rankBlocks() const { return _block_size > 0; }
+        template <RankDropLimitE use_rank_drop_limit>
+        void addToBlock(uint32_t docId) {
+            _block_docids.push_back(docId);
+            if (_block_docids.size() == _block_size) {
+                rankBlock<use_rank_drop_limit>();
+            }
+        }
+        template <RankDropLimitE use_rank_drop_limit>
+        void rankBlock();
         void addHit(uint32_t docId) { _hits.addHit(docId, search::zero_rank_value); }
         bool isBelowLimit() const { return matches < _matches_limit; }
         bool    isAtLimit() const { return matches == _matches_limit; }
@@ -84,11 +95,17 @@ private:
         vespalib::duration timeLeft() const { return _doom.soft_left(); }
         uint32_t        matches;
     private:
+        template <RankDropLimitE use_rank_drop_limit>
+        void addScoredHit(uint32_t docId, double score);
+
         uint32_t        _matches_limit;
         LazyValue       _score_feature;
         double          _first_phase_rank_score_drop_limit;
         HitCollector   &_hits;
         const Doom      _doom;
+        size_t          _block_size;
+        std::vector<uint32_t> _block_docids;
+        std::vector<search::feature_t> _block_scores;
     public:
         std::vector<uint32_t> dropped;
     };
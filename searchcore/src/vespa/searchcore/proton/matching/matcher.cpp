@@ -39,8 +39,10 @@ using search::fef::MatchData;
 using search::fef::RankSetup;
 using search::fef::indexproperties::hitcollector::HeapSize;
 using search::fef::indexproperties::hitcollector::ArraySize;
+using search::fef::indexproperties::hitcollector::TopKBatchSize;
 using search::fef::indexproperties::hitcollector::FirstPhaseRankScoreDropLimit;
 using search::fef::indexproperties::hitcollector::SecondPhaseRankScoreDropLimit;
+using search::fef::indexproperties::grouping::ApproximationFactor;
 using search::queryeval::Blueprint;
 using search::queryeval::SearchIterator;
 using vespalib::Doom;
@@ -88,11 +90,31 @@ willNeedRanking(const SearchRequest & request, const GroupingContext & groupingC
                first_phase_rank_score_drop_limit.has_value());
 }
 
+// Tells which grouping levels were pruned during aggregation (see vespa.grouping.approximationfactor).
+void
+traceGroupingApproximation(Trace & trace, GroupingContext & groupingContext) {
+    if ( ! trace.shouldTrace(1)) {
+        return;
+    }
+    for (const auto & grouping : groupingContext.getGroupingList()) {
+        const auto & levels = grouping->getLevels();
+        for (size_t i = 0; i < levels.size(); ++i) {
+            double error = levels[i].getApproximationError();
+            if (error > 0.0) {
+                trace.addEvent(1, fmt("Grouping %u level %zu is approximate: groups may miss up to %g of their count or sum",
+                                      grouping->getId(), i, error));
+            }
+        }
+    }
+}
+
 SearchReply::UP
-handleGroupingSession(SessionManager &sessionMgr, GroupingContext & groupingContext, GroupingSession::UP groupingSession)
+handleGroupingSession(SessionManager &sessionMgr, GroupingContext & groupingContext, GroupingSession::UP groupingSession,
+                      Trace & trace)
 {
     auto reply = std::make_unique<SearchReply>();
     groupingSession->continueExecution(groupingContext);
+    traceGroupingApproximation(trace, groupingContext);
     groupingContext.getResult().swap(reply->groupResult);
     if (!groupingSession->finished()) {
         sessionMgr.insert(std::move(groupingSession));
@@ -226,7 +248,7 @@ SearchReply::UP
 Matcher::match(const SearchRequest &request, vespalib::ThreadBundle &threadBundle,
                ISearchContext &searchContext, IAttributeContext &attrContext, SessionManager &sessionMgr,
                const search::IDocumentMetaStore &metaStore, const bucketdb::BucketDBOwner & bucketdb,
-               SearchSession::OwnershipBundle &&owned_objects)
+               SearchSession::OwnershipBundle &&owned_objects, const search::IDocumentStore *documentStore)
 {
     vespalib::Timer total_matching_time;
     MatchingStats my_stats;
@@ -246,7 +268,7 @@ Matcher::match(const SearchRequest &request, vespalib::ThreadBundle &threadBundl
             if (shouldCacheGroupingSession) {
                 GroupingSession::UP session(sessionMgr.pickGrouping(sessionId));
                 if (session) {
-                    return handleGroupingSession(sessionMgr, groupingContext, std::move(session));
+                    return handleGroupingSession(sessionMgr, groupingContext, std::move(session), request.trace());
                 }
             }
         }
@@ -273,6 +295,7 @@ Matcher::match(const SearchRequest &request, vespalib::ThreadBundle &threadBundl
         }
 
         const Properties & rankProperties = request.propertiesMap.rankProperties();
+        groupingContext.setApproximationFactor(ApproximationFactor::lookup(rankProperties, _rankSetup->getGroupingApproximationFactor()));
         uint32_t heapSize = HeapSize::lookup(rankProperties, _rankSetup->getHeapSize());
         uint32_t arraySize = ArraySize::lookup(rankProperties, _rankSetup->getArraySize());
         auto first_phase_rank_score_drop_limit = FirstPhaseRankScoreDropLimit::lookup(rankProperties, _rankSetup->get_first_phase_rank_score_drop_limit());
@@ -281,7 +304,9 @@ Matcher::match(const SearchRequest &request, vespalib::ThreadBundle &threadBundl
         MatchParams params(searchContext.getDocIdLimit(), heapSize, arraySize, first_phase_rank_score_drop_limit,
                            second_phase_rank_score_drop_limit,
                            request.offset, request.maxhits, !_rankSetup->getSecondPhaseRank().empty(),
-                           willNeedRanking(request, groupingContext, first_phase_rank_score_drop_limit));
+                           willNeedRanking(request, groupingContext, first_phase_rank_score_drop_limit),
+                           TopKBatchSize::lookup(rankProperties, _rankSetup->getTopKBatchSize()),
+                           BlockScoring::check(rankProperties, _rankSetup->block_scoring()));
 
         ResultProcessor rp(attrContext, metaStore, sessionMgr, groupingContext, sessionId,
                            request.sortSpec, params.offset, params.hits);
@@ -290,13 +315,17 @@ Matcher::match(const SearchRequest &request, vespalib::ThreadBundle &threadBundl
         vespalib::LimitedThreadBundleWrapper limitedThreadBundle(threadBundle, numThreadsPerSearch);
         MatchMaster master;
         uint32_t numParts = NumSearchPartitions::lookup(rankProperties, _rankSetup->getNumSearchPartitions());
+        bool workStealing = WorkStealing::check(rankProperties, _rankSetup->work_stealing());
+        const search::IDocumentStore *prefetchStore = summary::Prefetch::check(rankProperties, _rankSetup->prefetch_summary())
+                                                      ? documentStore : nullptr;
         if (limitedThreadBundle.size() > 1) {
             attrContext.enableMultiThreadSafe();
         }
         ResultProcessor::Result::UP result = master.match(request.trace(), params, limitedThreadBundle, *mtf, rp,
-                                                          _distributionKey, numParts);
+                                                          _distributionKey, numParts, workStealing, prefetchStore);
         my_stats = MatchMaster::getStats(std::move(master));
         reply = std::move(result->_reply);
+        traceGroupingApproximation(request.trace(), groupingContext);
         Coverage & coverage = reply->coverage;
         updateCoverage(coverage, mtf->match_limiter(), my_stats, metaStore, bucketdb);
 
@@ -34,6 +34,7 @@ namespace search::engine {
     class Coverage;
 }
 namespace search { struct IDocumentMetaStore; }
+namespace search { class IDocumentStore; }
 namespace search::fef { class RankSetup; }
 
 namespace proton::matching {
@@ -124,13 +125,14 @@ public:
      * @param attrContext abstract view of attribute data
      * @param sessionManager multilevel grouping session cache
      * @param metaStore the document meta store used to map from lid to gid
+     * @param documentStore the document store to prefetch top hits from, if enabled, may be nullptr
      **/
     std::unique_ptr<search::engine::SearchReply>
     match(const SearchRequest &request, vespalib::ThreadBundle &threadBundle,
           ISearchContext &searchContext, IAttributeContext &attrContext,
           SessionManager &sessionManager, const search::IDocumentMetaStore &metaStore,
           const bucketdb::BucketDBOwner & bucketdb,
-          SearchSession::OwnershipBundle &&owned_objects);
+          SearchSession::OwnershipBundle &&owned_objects, const search::IDocumentStore *documentStore);
 
     /**
      * Perform matching for the documents in the given docsum request
@@ -64,7 +64,7 @@ MatchView::createContext() const {
 
 std::unique_ptr<SearchReply>
 MatchView::match(std::shared_ptr<const ISearchHandler> searchHandler, const SearchRequest &req,
-                 vespalib::ThreadBundle &threadBundle) const
+                 vespalib::ThreadBundle &threadBundle, const search::IDocumentStore *documentStore) const
 {
     Matcher::SP matcher = getMatcher(req.ranking);
     SearchSession::OwnershipBundle owned_objects(createContext(), std::move(searchHandler));
@@ -74,7 +74,7 @@ MatchView::match(std::shared_ptr<const ISearchHandler> searchHandler, const Sear
     const search::IDocumentMetaStore & dms = owned_objects.readGuard->get();
     const bucketdb::BucketDBOwner & bucketDB = _metaStore->get().getBucketDB();
     return matcher->match(req, threadBundle, search_ctx, attribute_ctx,
-                          _sessionMgr, dms, bucketDB, std::move(owned_objects));
+                          _sessionMgr, dms, bucketDB, std::move(owned_objects), documentStore);
 }
 
 } // namespace proton
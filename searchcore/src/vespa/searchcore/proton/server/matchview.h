@@ -8,6 +8,7 @@
 #include <vespa/searchcore/proton/matching/match_context.h>
 #include <vespa/searchcore/proton/summaryengine/isearchhandler.h>
 
+namespace search { class IDocumentStore; }
 namespace searchcorespi { class IndexSearchable; }
 
 namespace proton::matching {
@@ -65,7 +66,8 @@ public:
     std::unique_ptr<search::engine::SearchReply>
     match(std::shared_ptr<const ISearchHandler> searchHandler,
           const search::engine::SearchRequest &req,
-          vespalib::ThreadBundle &threadBundle) const;
+          vespalib::ThreadBundle &threadBundle,
+          const search::IDocumentStore *documentStore) const;
 };
 
 } // namespace proton
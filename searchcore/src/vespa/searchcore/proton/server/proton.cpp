@@ -168,7 +168,8 @@ make_posting_list_cache(const ProtonConfig& cfg)
     if (cfg.search.io == ProtonConfig::Search::Io::MMAP || cfg.index.postinglist.cache.maxbytes == 0) {
         return {};
     }
-    return std::make_shared<PostingListCache>(cfg.index.postinglist.cache.maxbytes);
+    return std::make_shared<PostingListCache>(cfg.index.postinglist.cache.maxbytes,
+                                              cfg.index.postinglist.cache.admissionfilter);
 }
 
 } // namespace <unnamed>
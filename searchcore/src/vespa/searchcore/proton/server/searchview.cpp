@@ -143,7 +143,7 @@ SearchView::getDocsumsInternal(const DocsumRequest & req)
 
 std::unique_ptr<SearchReply>
 SearchView::match(const SearchRequest &req, ThreadBundle &threadBundle) const {
-    return _matchView->match(shared_from_this(), req, threadBundle);
+    return _matchView->match(shared_from_this(), req, threadBundle, &_summarySetup->getDocumentStore());
 }
 
 } // namespace proton
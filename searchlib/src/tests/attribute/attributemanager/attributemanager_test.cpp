@@ -300,6 +300,14 @@ TEST("require that config can be converted")
         EXPECT_TRUE(params.distance_metric() == dm_out);
         EXPECT_FALSE(params.multi_threaded_indexing());
     }
+    { // hnsw index quantized vectors (only when paged)
+        CACA a;
+        a.index.hnsw.enabled = true;
+        a.index.hnsw.quantizevectors = true;
+        EXPECT_FALSE(ConfigConverter::convert(a).hnsw_index_params().value().quantize_vectors());
+        a.paged = true;
+        EXPECT_TRUE(ConfigConverter::convert(a).hnsw_index_params().value().quantize_vectors());
+    }
     { // hnsw index params (disabled)
         CACA a;
         a.index.hnsw.enabled = false;
@@ -1,23 +1,32 @@
 // Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
 
+#include <vespa/searchlib/diskindex/frequency_sketch.h>
 #include <vespa/searchlib/diskindex/posting_list_cache.h>
 #include <vespa/vespalib/util/size_literals.h>
 #include <vespa/vespalib/gtest/gtest.h>
+#include <cstdlib>
+#include <cstring>
 
+using search::diskindex::FrequencySketch;
 using search::diskindex::PostingListCache;
 using search::index::PostingListHandle;
 
 namespace {
 
+constexpr size_t direct_io_padding = 4_Ki;
+
 class MockFile : public PostingListCache::IPostingListFileBacking {
+    bool _padded;
 public:
     MockFile();
     ~MockFile() override;
     PostingListHandle read(const PostingListCache::Key& key) const override;
+    void set_padded(bool padded) { _padded = padded; }
 };
 
 MockFile::MockFile()
-    : PostingListCache::IPostingListFileBacking()
+    : PostingListCache::IPostingListFileBacking(),
+      _padded(false)
 {
 }
 
@@ -28,6 +37,22 @@ MockFile::read(const PostingListCache::Key& key) const
 {
     EXPECT_NE(0, key.bit_length);
     PostingListHandle handle;
+    if (_padded) {
+        // Emulate posting list read using direct io, with padding before and after posting list
+        handle._bitOffsetMem = key.bit_offset & ~uint64_t(63);
+        size_t vector_len = (key.bit_offset + key.bit_length - handle._bitOffsetMem + 63) / 64 * 8;
+        size_t alloc_size = direct_io_padding + vector_len + direct_io_padding;
+        auto* buf = static_cast<char*>(malloc(alloc_size));
+        memset(buf, 0xff, alloc_size);
+        for (size_t i = 0; i < vector_len; ++i) {
+            buf[direct_io_padding + i] = static_cast<char>(i);
+        }
+        handle._mem = buf + direct_io_padding;
+        handle._allocMem = std::shared_ptr<void>(buf, free);
+        handle._allocSize = alloc_size;
+        handle._read_bytes = alloc_size;
+        return handle;
+    }
     handle._allocSize = key.bit_length / 8;
     return handle;
 }
@@ -42,14 +67,20 @@ protected:
     PostingListCache _cache;
     Key _key;
     PostingListCacheTest();
+    explicit PostingListCacheTest(bool admission_filter);
     ~PostingListCacheTest() override;
     PostingListHandle read() { return _cache.read(_key); }
 };
 
 PostingListCacheTest::PostingListCacheTest()
+    : PostingListCacheTest(false)
+{
+}
+
+PostingListCacheTest::PostingListCacheTest(bool admission_filter)
     : ::testing::Test(),
       _mock_file(),
-      _cache(256_Ki),
+      _cache(256_Ki, admission_filter),
       _key()
 {
     _key.backing_store_file = &_mock_file;
@@ -104,4 +135,104 @@ TEST_F(PostingListCacheTest, file_id_is_part_of_key)
     EXPECT_EQ(2, stats.elements);
 }
 
+TEST_F(PostingListCacheTest, padding_is_trimmed_from_small_posting_lists)
+{
+    _mock_file.set_padded(true);
+    _key.bit_offset = 1000;
+    _key.bit_length = 100 * 8;
+    auto handle = read();
+    // posting list starts at bit 1000 - 960 = 40, i.e. 105 bytes rounded up to 112 bytes
+    EXPECT_EQ(112 + 16, handle._allocSize);
+    EXPECT_EQ(2 * direct_io_padding + 112, handle._read_bytes);
+    EXPECT_EQ(960, handle._bitOffsetMem);
+    auto mem = static_cast<const char*>(handle._mem);
+    for (size_t i = 0; i < 112; ++i) {
+        EXPECT_EQ(static_cast<char>(i), mem[i]);
+    }
+    for (size_t i = 112; i < 112 + 16; ++i) {
+        EXPECT_EQ(0, mem[i]);
+    }
+    auto stats = _cache.get_stats();
+    EXPECT_EQ(PostingListCache::element_size() + 112 + 16, stats.memory_used);
+}
+
+TEST_F(PostingListCacheTest, padding_is_kept_for_large_posting_lists)
+{
+    _mock_file.set_padded(true);
+    _key.bit_length = 128_Ki * 8;
+    auto handle = read();
+    EXPECT_EQ(2 * direct_io_padding + 128_Ki, handle._allocSize);
+}
+
+class PostingListCacheAdmissionTest : public PostingListCacheTest
+{
+protected:
+    PostingListCacheAdmissionTest();
+    ~PostingListCacheAdmissionTest() override;
+};
+
+PostingListCacheAdmissionTest::PostingListCacheAdmissionTest()
+    : PostingListCacheTest(true)
+{
+}
+
+PostingListCacheAdmissionTest::~PostingListCacheAdmissionTest() = default;
+
+TEST_F(PostingListCacheAdmissionTest, one_off_posting_list_is_not_admitted_into_full_cache)
+{
+    _key.bit_length = 200_Ki * 8;
+    (void) read(); // Cache not full, admitted
+    _key.bit_offset = 2_Mi * 8;
+    _key.bit_length = 100_Ki * 8;
+    auto handle = read(); // Cache full, first access, not admitted
+    EXPECT_EQ(100_Ki, handle._allocSize);
+    auto stats = _cache.get_stats();
+    EXPECT_EQ(2, stats.misses);
+    EXPECT_EQ(1, stats.elements);
+    EXPECT_EQ(PostingListCache::element_size() + 200_Ki, stats.memory_used);
+    (void) read(); // Cache full, second access, admitted
+    stats = _cache.get_stats();
+    EXPECT_EQ(3, stats.misses);
+    EXPECT_EQ(2, stats.elements);
+    (void) read();
+    stats = _cache.get_stats();
+    EXPECT_EQ(1, stats.hits);
+}
+
+TEST(FrequencySketchTest, estimate_follows_additions)
+{
+    FrequencySketch sketch(1000);
+    EXPECT_EQ(1024, sketch.num_counters());
+    EXPECT_EQ(0, sketch.estimate(42));
+    sketch.add(42);
+    EXPECT_EQ(1, sketch.estimate(42));
+    sketch.add(42);
+    sketch.add(42);
+    EXPECT_EQ(3, sketch.estimate(42));
+    EXPECT_EQ(0, sketch.estimate(43));
+}
+
+TEST(FrequencySketchTest, estimate_saturates)
+{
+    FrequencySketch sketch(1000);
+    for (uint32_t i = 0; i < 20; ++i) {
+        sketch.add(42);
+    }
+    EXPECT_EQ(15, sketch.estimate(42));
+}
+
+TEST(FrequencySketchTest, counters_are_halved_when_sample_size_is_reached)
+{
+    FrequencySketch sketch(64);
+    EXPECT_EQ(640, sketch.sample_size());
+    for (uint32_t i = 0; i < 8; ++i) {
+        sketch.add(42);
+    }
+    EXPECT_EQ(8, sketch.estimate(42));
+    for (uint64_t i = 0; i < sketch.sample_size() - 8; ++i) {
+        sketch.add(1000 + (i % 4));
+    }
+    EXPECT_EQ(4, sketch.estimate(42));
+}
+
 GTEST_MAIN_RUN_ALL_TESTS()
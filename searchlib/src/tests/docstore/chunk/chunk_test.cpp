@@ -7,6 +7,8 @@
 #include <vespa/searchlib/docstore/chunkformat.h>
 #include <vespa/searchlib/docstore/chunkformats.h>
 #include <vespa/vespalib/objects/hexdump.h>
+#include <vespa/vespalib/util/stringfmt.h>
+#include <vespa/vespalib/util/zstdcompressor.h>
 #include <string>
 #include <zstd.h>
 
@@ -14,6 +16,7 @@ LOG_SETUP("chunk_test");
 
 using namespace search;
 using vespalib::compression::CompressionConfig;
+using vespalib::compression::ZStdDictionary;
 
 TEST("require that Chunk obey limits")
 {
@@ -100,4 +103,59 @@ TEST("require that V2 can create and handle lz4, zstd, and none") {
     verifyChunkCompression(CompressionConfig::ZSTD, MY_LONG_STRING, strlen(MY_LONG_STRING), zstd_compressed_length);
 }
 
+std::string
+makeEntry(size_t i) {
+    return vespalib::make_string("{\"id\":\"id:ns:music::%zu\",\"title\":\"Title %zu\",\"album\":\"Album %zu\",\"year\":%zu}",
+                                 i, i*3, i % 17, 1960 + (i % 60));
+}
+
+Chunk::UP
+createChunk(size_t first, size_t count) {
+    auto chunk = std::make_unique<Chunk>(0, Chunk::Config(0x10000));
+    for (size_t i(first); i < first + count; i++) {
+        std::string entry = makeEntry(i);
+        chunk->append(i, {entry.data(), entry.size()});
+    }
+    return chunk;
+}
+
+std::unique_ptr<ZStdDictionary>
+trainDictionary() {
+    vespalib::DataBuffer samples;
+    std::vector<size_t> sizes;
+    for (size_t i(0); i < 2000; i++) {
+        std::string entry = makeEntry(i);
+        samples.writeBytes(entry.data(), entry.size());
+        sizes.push_back(entry.size());
+    }
+    return ZStdDictionary::train({samples.getData(), samples.getDataLen()}, sizes, 4096);
+}
+
+void
+verifyChunkContent(const Chunk & chunk, size_t first, size_t count) {
+    EXPECT_EQUAL(count, chunk.count());
+    for (size_t i(first); i < first + count; i++) {
+        vespalib::ConstBufferRef buf = chunk.getLid(i);
+        EXPECT_EQUAL(makeEntry(i), std::string(buf.c_str(), buf.size()));
+    }
+}
+
+TEST("require that Chunk can be compressed with a zstd dictionary") {
+    auto dictionary = trainDictionary();
+    ASSERT_TRUE(dictionary);
+    CompressionConfig cfg(CompressionConfig::ZSTD);
+    vespalib::DataBuffer plainBuffer;
+    createChunk(5000, 10)->pack(7, plainBuffer, cfg);
+    vespalib::DataBuffer dictionaryBuffer;
+    createChunk(5000, 10)->pack(7, dictionaryBuffer, cfg, dictionary.get());
+    EXPECT_LESS(dictionaryBuffer.getDataLen(), plainBuffer.getDataLen());
+
+    Chunk deserialized(1, dictionaryBuffer.getData(), dictionaryBuffer.getDataLen(), dictionary.get());
+    EXPECT_EQUAL(7u, deserialized.getLastSerial());
+    TEST_DO(verifyChunkContent(deserialized, 5000, 10));
+
+    Chunk deserializedPlain(2, plainBuffer.getData(), plainBuffer.getDataLen(), dictionary.get());
+    TEST_DO(verifyChunkContent(deserializedPlain, 5000, 10));
+}
+
 TEST_MAIN() { TEST_RUN_ALL(); }
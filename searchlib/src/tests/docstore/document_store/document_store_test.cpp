@@ -3,7 +3,11 @@
 #include <vespa/searchlib/docstore/value.h>
 #include <vespa/vespalib/stllike/cache_stats.h>
 #include <vespa/document/repo/documenttyperepo.h>
+#include <vespa/document/datatype/documenttype.h>
 #include <vespa/document/fieldvalue/document.h>
+#include <vespa/vespalib/objects/nbostream.h>
+#include <functional>
+#include <map>
 #include <vespa/vespalib/testkit/test_kit.h>
 #include <vespa/vespalib/testkit/test_master.hpp>
 
@@ -68,6 +72,147 @@ TEST_FFF("require that cached docstore lookups are counted",
     EXPECT_EQUAL(1u, f3.getCacheStats().misses);
 }
 
+struct MapDataStore : NullDataStore {
+    std::map<uint32_t, vespalib::nbostream> docs;
+    mutable size_t single_reads = 0;
+    mutable size_t batch_reads = 0;
+    mutable LidVector prefetched;
+    std::function<void()> after_batch_read;
+    MapDataStore();
+    ~MapDataStore() override;
+    void put(uint32_t lid) {
+        document::Document doc(repo, *repo.getDefaultDocType(), document::DocumentId("id:ns:document::" + std::to_string(lid)));
+        doc.serialize(docs[lid]);
+    }
+    ssize_t read(uint32_t lid, vespalib::DataBuffer & buffer) const override {
+        ++single_reads;
+        auto found = docs.find(lid);
+        if (found == docs.end()) {
+            return 0;
+        }
+        buffer.writeBytes(found->second.peek(), found->second.size());
+        return found->second.size();
+    }
+    void read(const LidVector & lids, IBufferVisitor & visitor) const override {
+        ++batch_reads;
+        std::vector<std::pair<uint32_t, vespalib::nbostream>> read_docs;
+        for (uint32_t lid : lids) {
+            auto found = docs.find(lid);
+            if (found != docs.end()) {
+                read_docs.emplace_back(lid, found->second);
+            }
+        }
+        if (after_batch_read) {
+            after_batch_read();
+        }
+        for (const auto & doc : read_docs) {
+            visitor.visit(doc.first, vespalib::ConstBufferRef(doc.second.peek(), doc.second.size()));
+        }
+    }
+    void write(uint64_t, uint32_t lid, const void * buffer, size_t len) override {
+        vespalib::nbostream & os = docs[lid];
+        os.clear();
+        os.write(buffer, len);
+    }
+    void remove(uint64_t, uint32_t lid) override {
+        docs.erase(lid);
+    }
+    void prefetch(const LidVector & lids) const override {
+        prefetched.insert(prefetched.end(), lids.begin(), lids.end());
+    }
+};
+
+MapDataStore::MapDataStore() = default;
+MapDataStore::~MapDataStore() = default;
+
+struct CollectingVisitor : IDocumentVisitor {
+    std::map<uint32_t, DocumentUP> docs;
+    void visit(uint32_t lid, DocumentUP doc) override { docs[lid] = std::move(doc); }
+    bool allowVisitCaching() const override { return false; }
+};
+
+void
+verify_read_many(const DocumentStore & store, const std::vector<uint32_t> & lids, const std::vector<uint32_t> & expected)
+{
+    CollectingVisitor visitor;
+    store.readMany(lids, repo, visitor);
+    ASSERT_EQUAL(expected.size(), visitor.docs.size());
+    for (uint32_t lid : expected) {
+        ASSERT_TRUE(visitor.docs[lid]);
+        EXPECT_EQUAL("id:ns:document::" + std::to_string(lid), visitor.docs[lid]->getId().toString());
+    }
+}
+
+TEST("require that readMany without cache reads all lids in one batch") {
+    MapDataStore store;
+    store.put(1);
+    store.put(3);
+    DocumentStore docStore(DocumentStore::Config(CompressionConfig::NONE, 0), store);
+    TEST_DO(verify_read_many(docStore, {3, 2, 1}, {1, 3}));
+    EXPECT_EQUAL(1u, store.batch_reads);
+    EXPECT_EQUAL(0u, store.single_reads);
+    EXPECT_EQUAL(3u, docStore.getCacheStats().misses);
+}
+
+TEST("require that readMany populates cache and serves cached lids from it") {
+    MapDataStore store;
+    store.put(1);
+    store.put(2);
+    store.put(3);
+    DocumentStore docStore(DocumentStore::Config(CompressionConfig::LZ4, 100000), store);
+    EXPECT_TRUE(docStore.read(2, repo));
+    EXPECT_EQUAL(1u, store.single_reads);
+    TEST_DO(verify_read_many(docStore, {1, 2, 3}, {1, 2, 3}));
+    EXPECT_EQUAL(1u, store.batch_reads);
+    EXPECT_EQUAL(1u, store.single_reads);
+    TEST_DO(verify_read_many(docStore, {1, 3}, {1, 3}));
+    EXPECT_EQUAL(1u, store.batch_reads);
+    EXPECT_EQUAL(1u, store.single_reads);
+    EXPECT_TRUE(docStore.read(3, repo));
+    EXPECT_EQUAL(1u, store.single_reads);
+}
+
+TEST("require that readMany does not populate cache with documents written or removed during the batch read") {
+    MapDataStore store;
+    store.put(1);
+    store.put(2);
+    store.put(3);
+    DocumentStore docStore(DocumentStore::Config(CompressionConfig::LZ4, 100000), store);
+    store.after_batch_read = [&docStore]() {
+        docStore.remove(10, 1);
+        document::Document doc(repo, *repo.getDefaultDocType(), document::DocumentId("id:ns:document::2"));
+        docStore.write(11, 2, doc);
+    };
+    TEST_DO(verify_read_many(docStore, {1, 2, 3}, {1, 2, 3}));
+    store.after_batch_read = {};
+    EXPECT_FALSE(docStore.read(1, repo));
+    EXPECT_EQUAL(1u, store.single_reads);
+    EXPECT_TRUE(docStore.read(2, repo));
+    EXPECT_EQUAL(2u, store.single_reads);
+    EXPECT_TRUE(docStore.read(3, repo));
+    EXPECT_EQUAL(2u, store.single_reads);
+}
+
+TEST("require that prefetch is passed on to the backing store for lids not in cache") {
+    MapDataStore store;
+    store.put(1);
+    store.put(2);
+    store.put(3);
+    DocumentStore uncached(DocumentStore::Config(CompressionConfig::NONE, 0), store);
+    uncached.prefetch({3, 1});
+    EXPECT_TRUE(IDataStore::LidVector({3, 1}) == store.prefetched);
+    store.prefetched.clear();
+    DocumentStore cached(DocumentStore::Config(CompressionConfig::LZ4, 100000), store);
+    EXPECT_TRUE(cached.read(2, repo));
+    cached.prefetch({1, 2, 3});
+    EXPECT_TRUE(IDataStore::LidVector({1, 3}) == store.prefetched);
+    store.prefetched.clear();
+    cached.prefetch({2});
+    EXPECT_TRUE(store.prefetched.empty());
+    EXPECT_EQUAL(0u, store.batch_reads);
+    EXPECT_EQUAL(1u, store.single_reads);
+}
+
 TEST("require that DocumentStore::Config equality operator detects inequality") {
     using C = DocumentStore::Config;
     EXPECT_TRUE(C() == C());
@@ -4,11 +4,13 @@
 #include <vespa/searchlib/docstore/filechunk.h>
 #include <vespa/searchlib/docstore/writeablefilechunk.h>
 #include <vespa/searchlib/test/directory_handler.h>
+#include <vespa/vespalib/data/databuffer.h>
 #include <vespa/vespalib/gtest/gtest.h>
 #include <vespa/vespalib/testkit/test_path.h>
 #include <vespa/vespalib/util/cpu_usage.h>
 #include <vespa/vespalib/util/compressionconfig.h>
 #include <vespa/vespalib/util/threadstackexecutor.h>
+#include <vespa/vespalib/util/zstdcompressor.h>
 #include <iomanip>
 
 #include <vespa/log/log.h>
@@ -20,6 +22,7 @@ using namespace search;
 using common::FileHeaderContext;
 using vespalib::CpuUsage;
 using vespalib::ThreadStackExecutor;
+using vespalib::compression::ZStdDictionary;
 
 struct MyFileHeaderContext : public FileHeaderContext {
     void addTags(vespalib::GenericHeader &header, const std::string &name) const override {
@@ -115,10 +118,12 @@ struct WriteFixture : public FixtureBase {
 
     WriteFixture(const std::string &baseName,
                  uint32_t docIdLimit,
-                 bool dirCleanup = true)
+                 bool dirCleanup = true,
+                 CompressionConfig compression = CompressionConfig(),
+                 std::shared_ptr<const ZStdDictionary> dictionary = {})
         : FixtureBase(baseName, dirCleanup),
           chunk(executor, FileChunk::FileId(0), FileChunk::NameId(1234), baseName, serialNum, docIdLimit,
-                {CompressionConfig(), 0x1000}, tuneFile, fileHeaderCtx, &bucketizer)
+                {compression, 0x1000}, tuneFile, fileHeaderCtx, &bucketizer, std::move(dictionary))
     {
         dir.cleanup(dirCleanup);
     }
@@ -127,7 +132,9 @@ struct WriteFixture : public FixtureBase {
         chunk.flushPendingChunks(serialNum);
     }
     WriteFixture &append(uint32_t lid) {
-        std::string data = getData(lid);
+        return append(lid, getData(lid));
+    }
+    WriteFixture &append(uint32_t lid, const std::string & data) {
         chunk.append(nextSerialNum(), lid, {data.c_str(), data.size()}, CpuUsage::Category::WRITE);
         return *this;
     }
@@ -226,6 +233,72 @@ TEST(FileChunkTest, require_that_entries_with_lid_ge__docIdLimit_are_skipped_in_
 
 using vespalib::compression::CompressionConfig;
 
+std::string
+getDocument(uint32_t lid)
+{
+    std::ostringstream oss;
+    oss << "{\"id\":\"id:ns:music::" << lid << "\",\"title\":\"Title " << lid * 3
+        << "\",\"album\":\"Album " << lid % 17 << "\",\"year\":" << 1960 + (lid % 60) << "}";
+    return oss.str();
+}
+
+std::shared_ptr<const ZStdDictionary>
+trainDictionary(const FileChunk & chunk, std::vector<std::string> & samples)
+{
+    vespalib::DataBuffer buffer;
+    std::vector<size_t> sizes;
+    chunk.sampleEntries(1024 * 1024, buffer, sizes);
+    const char * data = buffer.getData();
+    for (size_t sz : sizes) {
+        samples.emplace_back(data, sz);
+        data += sz;
+    }
+    return ZStdDictionary::train({buffer.getData(), buffer.getDataLen()}, sizes, 2048);
+}
+
+TEST(FileChunkTest, require_that_zstd_dictionary_is_written_to_and_read_from_dat_file_header)
+{
+    constexpr uint32_t numDocs = 2000;
+    {
+        WriteFixture f("tmp", 0, false);
+        for (uint32_t lid = 1; lid <= numDocs; ++lid) {
+            f.append(lid, getDocument(lid));
+        }
+        f.flush();
+    }
+    std::shared_ptr<const ZStdDictionary> dictionary;
+    {
+        ReadFixture f("tmp", false);
+        f.updateLidMap(numDocs + 1);
+        f.chunk.enableRead();
+        EXPECT_FALSE(f.chunk.getDictionary());
+        std::vector<std::string> samples;
+        dictionary = trainDictionary(f.chunk, samples);
+        ASSERT_TRUE(dictionary);
+        ASSERT_FALSE(samples.empty());
+        EXPECT_EQ(getDocument(1), samples[0]);
+        f.chunk.erase();
+    }
+    {
+        WriteFixture f("tmp", 0, false, CompressionConfig(CompressionConfig::ZSTD), dictionary);
+        for (uint32_t lid = 1; lid <= numDocs; ++lid) {
+            f.append(lid, getDocument(lid));
+        }
+        f.flush();
+    }
+    {
+        ReadFixture f("tmp");
+        f.updateLidMap(numDocs + 1);
+        f.chunk.enableRead();
+        ASSERT_TRUE(f.chunk.getDictionary());
+        EXPECT_EQ(dictionary->id(), f.chunk.getDictionary()->id());
+        std::vector<std::string> samples;
+        trainDictionary(f.chunk, samples);
+        ASSERT_FALSE(samples.empty());
+        EXPECT_EQ(getDocument(1), samples[0]);
+    }
+}
+
 TEST(FileChunkTest, require_that_operator_eq_detects_inequality) {
     using C = WriteableFileChunk::Config;
     EXPECT_TRUE(C() == C());
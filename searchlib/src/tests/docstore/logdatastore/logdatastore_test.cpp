@@ -1186,6 +1186,7 @@ TEST_F(LogDataStoreTest, require_that_config_equality_operator_detects_inequalit
     EXPECT_FALSE(C() == C().setMinFileSizeFactor(0.3));
     EXPECT_FALSE(C() == C().setFileConfig(WriteableFileChunk::Config({}, 70)));
     EXPECT_FALSE(C() == C().compactCompression({CompressionConfig::ZSTD}));
+    EXPECT_FALSE(C() == C().setCompactDictionarySize(64_Ki));
 }
 
 int
@@ -0,0 +1,119 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include <vespa/searchlib/docstore/randreaders.h>
+#include <vespa/searchlib/test/directory_handler.h>
+#include <vespa/vespalib/data/databuffer.h>
+#include <vespa/vespalib/gtest/gtest.h>
+#include <vespa/vespalib/io/fileutil.h>
+#include <vespa/vespalib/util/exceptions.h>
+#include <string_view>
+
+#include <vespa/log/log.h>
+LOG_SETUP("randreaders_test");
+
+using namespace search;
+using vespalib::DataBuffer;
+
+namespace {
+
+constexpr size_t FILE_SIZE = 100000;
+
+std::string
+make_content()
+{
+    std::string content;
+    content.reserve(FILE_SIZE);
+    for (size_t i(0); i < FILE_SIZE; i++) {
+        content.push_back(char('a' + (i * 7) % 26));
+    }
+    return content;
+}
+
+std::string_view
+as_view(const DataBuffer & buffer)
+{
+    return {buffer.getData(), buffer.getDataLen()};
+}
+
+}
+
+struct RandReadersTest : ::testing::Test {
+    test::DirectoryHandler dir;
+    std::string            file_name;
+    std::string            content;
+    RandReadersTest()
+        : dir("randreaders_test_dir"),
+          file_name(dir.getDir() + "/file.dat"),
+          content(make_content())
+    {
+        vespalib::File file(file_name);
+        file.open(vespalib::File::CREATE | vespalib::File::TRUNC);
+        file.write(content.data(), content.size(), 0);
+    }
+    ~RandReadersTest() override;
+
+    void verify_read_many(FileRandRead & reader) {
+        std::vector<size_t> offsets = {70000, 3, 4096, 99000, 12345, 0};
+        std::vector<size_t> sizes = {1000, 100, 4096, 1000, 1, 17};
+        std::vector<DataBuffer> buffers;
+        std::vector<FileRandRead::ReadRequest> requests;
+        buffers.reserve(offsets.size());
+        for (size_t i(0); i < offsets.size(); i++) {
+            buffers.emplace_back(0ul, 0x1000);
+            requests.push_back({offsets[i], sizes[i], &buffers.back()});
+        }
+        auto keep_alive = reader.readMany(requests);
+        for (size_t i(0); i < offsets.size(); i++) {
+            EXPECT_EQ(std::string_view(content).substr(offsets[i], sizes[i]), as_view(buffers[i])) << "request " << i;
+        }
+    }
+};
+
+RandReadersTest::~RandReadersTest() = default;
+
+TEST_F(RandReadersTest, normal_rand_read_can_read_many)
+{
+    NormalRandRead reader(file_name);
+    EXPECT_EQ(int64_t(FILE_SIZE), reader.getSize());
+    verify_read_many(reader);
+    EXPECT_FALSE(reader.prefersBatchedReads());
+}
+
+TEST_F(RandReadersTest, uring_rand_read_can_read_single_range)
+{
+    UringRandRead reader(file_name);
+    EXPECT_EQ(int64_t(FILE_SIZE), reader.getSize());
+    DataBuffer buffer(0ul, 0x1000);
+    reader.read(50000, buffer, 2000);
+    EXPECT_EQ(std::string_view(content).substr(50000, 2000), as_view(buffer));
+}
+
+TEST_F(RandReadersTest, uring_rand_read_can_read_many)
+{
+    UringRandRead reader(file_name);
+    EXPECT_TRUE(reader.prefersBatchedReads());
+    verify_read_many(reader);
+    // More requests than the ring can hold at once
+    std::vector<DataBuffer> buffers;
+    std::vector<FileRandRead::ReadRequest> requests;
+    buffers.reserve(500);
+    for (size_t i(0); i < 500; i++) {
+        buffers.emplace_back(0ul, 0x1000);
+        requests.push_back({i * 199, 150, &buffers.back()});
+    }
+    reader.readMany(requests);
+    for (size_t i(0); i < 500; i++) {
+        EXPECT_EQ(std::string_view(content).substr(i * 199, 150), as_view(buffers[i]));
+    }
+}
+
+TEST_F(RandReadersTest, uring_rand_read_fails_reading_past_end_of_file)
+{
+    UringRandRead reader(file_name);
+    DataBuffer a(0ul, 0x1000);
+    DataBuffer b(0ul, 0x1000);
+    std::vector<FileRandRead::ReadRequest> requests = {{0, 100, &a}, {FILE_SIZE - 10, 100, &b}};
+    EXPECT_THROW(reader.readMany(requests), vespalib::IoException);
+}
+
+GTEST_MAIN_RUN_ALL_TESTS()
@@ -243,6 +243,14 @@ TEST(PropertiesTest, test_stuff)
             p.add("vespa.eval.use_fast_forest", "true");
             EXPECT_EQ(eval::UseFastForest::check(p), true);
         }
+        { // vespa.eval.inline_expressions
+            EXPECT_EQ(eval::InlineExpressions::NAME, std::string("vespa.eval.inline_expressions"));
+            EXPECT_EQ(eval::InlineExpressions::DEFAULT_VALUE, false);
+            Properties p;
+            EXPECT_EQ(eval::InlineExpressions::check(p), false);
+            p.add("vespa.eval.inline_expressions", "true");
+            EXPECT_EQ(eval::InlineExpressions::check(p), true);
+        }
         { // vespa.rank.firstphase
             EXPECT_EQ(rank::FirstPhase::NAME, std::string("vespa.rank.firstphase"));
             EXPECT_EQ(rank::FirstPhase::DEFAULT_VALUE, std::string("nativeRank"));
@@ -279,6 +287,15 @@ TEST(PropertiesTest, test_stuff)
             p.add("vespa.dump.ignoredefaultfeatures", "true");
             EXPECT_TRUE(dump::IgnoreDefaultFeatures::check(p));
         }
+        { // vespa.summary.prefetch
+            EXPECT_EQ(summary::Prefetch::NAME, std::string("vespa.summary.prefetch"));
+            EXPECT_EQ(summary::Prefetch::DEFAULT_VALUE, false);
+            Properties p;
+            EXPECT_FALSE(summary::Prefetch::check(p));
+            EXPECT_TRUE(summary::Prefetch::check(p, true));
+            p.add("vespa.summary.prefetch", "true");
+            EXPECT_TRUE(summary::Prefetch::check(p, false));
+        }
         { // vespa.matching.termwise_limit
             EXPECT_EQ(matching::TermwiseLimit::NAME, std::string("vespa.matching.termwise_limit"));
             EXPECT_EQ(matching::TermwiseLimit::DEFAULT_VALUE, 1.0);
@@ -312,6 +329,26 @@ TEST(PropertiesTest, test_stuff)
             p.add("vespa.matching.numsearchpartitions", "50");
             EXPECT_EQ(matching::NumSearchPartitions::lookup(p), 50u);
         }
+        { // vespa.matching.work_stealing
+            EXPECT_EQ(matching::WorkStealing::NAME, std::string("vespa.matching.work_stealing"));
+            EXPECT_EQ(matching::WorkStealing::DEFAULT_VALUE, false);
+            Properties p;
+            EXPECT_FALSE(matching::WorkStealing::check(p));
+            EXPECT_TRUE(matching::WorkStealing::check(p, true));
+            p.add("vespa.matching.work_stealing", "true");
+            EXPECT_TRUE(matching::WorkStealing::check(p));
+            EXPECT_TRUE(matching::WorkStealing::check(p, false));
+        }
+        { // vespa.matching.block_scoring
+            EXPECT_EQ(matching::BlockScoring::NAME, std::string("vespa.matching.block_scoring"));
+            EXPECT_EQ(matching::BlockScoring::DEFAULT_VALUE, false);
+            Properties p;
+            EXPECT_FALSE(matching::BlockScoring::check(p));
+            EXPECT_TRUE(matching::BlockScoring::check(p, true));
+            p.add("vespa.matching.block_scoring", "true");
+            EXPECT_TRUE(matching::BlockScoring::check(p));
+            EXPECT_TRUE(matching::BlockScoring::check(p, false));
+        }
         { // vespa.matchphase.degradation.attribute
             EXPECT_EQ(matchphase::DegradationAttribute::NAME, std::string("vespa.matchphase.degradation.attribute"));
             EXPECT_EQ(matchphase::DegradationAttribute::DEFAULT_VALUE, "");
@@ -392,6 +429,23 @@ TEST(PropertiesTest, test_stuff)
             p.add("vespa.hitcollector.arraysize", "50");
             EXPECT_EQ(hitcollector::ArraySize::lookup(p), 50u);
         }
+        { // vespa.hitcollector.topkbatchsize
+            EXPECT_EQ(hitcollector::TopKBatchSize::NAME, std::string("vespa.hitcollector.topkbatchsize"));
+            EXPECT_EQ(hitcollector::TopKBatchSize::DEFAULT_VALUE, 0u);
+            Properties p;
+            EXPECT_EQ(hitcollector::TopKBatchSize::lookup(p), 0u);
+            p.add("vespa.hitcollector.topkbatchsize", "1024");
+            EXPECT_EQ(hitcollector::TopKBatchSize::lookup(p), 1024u);
+        }
+        { // vespa.hitcollector.earlyterminationfactor
+            EXPECT_EQ(hitcollector::EarlyTerminationFactor::NAME, std::string("vespa.hitcollector.earlyterminationfactor"));
+            EXPECT_EQ(hitcollector::EarlyTerminationFactor::DEFAULT_VALUE, 0.0);
+            Properties p;
+            EXPECT_EQ(hitcollector::EarlyTerminationFactor::lookup(p), 0.0);
+            EXPECT_EQ(hitcollector::EarlyTerminationFactor::lookup(p, 4.0), 4.0);
+            p.add("vespa.hitcollector.earlyterminationfactor", "2.5");
+            EXPECT_EQ(hitcollector::EarlyTerminationFactor::lookup(p), 2.5);
+        }
         { // vespa.hitcollector.estimatepoint
             EXPECT_EQ(hitcollector::EstimatePoint::NAME, std::string("vespa.hitcollector.estimatepoint"));
             EXPECT_EQ(hitcollector::EstimatePoint::DEFAULT_VALUE, 0xffffffffu);
@@ -99,11 +99,18 @@ struct Fixture {
         indexEnv.getProperties().add(indexproperties::eval::UseFastForest::NAME, "true");
         return *this;
     }
-    Fixture &add_expr(const std::string &name, const std::string &expr) {
-        std::string feature_name = expr_feature(name);
-        std::string expr_name = feature_name + ".rankingScript";
+    Fixture &inline_expressions() {
+        indexEnv.getProperties().add(indexproperties::eval::InlineExpressions::NAME, "true");
+        return *this;
+    }
+    Fixture &add_function(const std::string &name, const std::string &expr) {
+        std::string expr_name = expr_feature(name) + ".rankingScript";
         indexEnv.getProperties().add(expr_name, expr);
-        add(feature_name);
+        return *this;
+    }
+    Fixture &add_expr(const std::string &name, const std::string &expr) {
+        add_function(name, expr);
+        add(expr_feature(name));
         return *this;
     }
     Fixture &add(const std::string &feature) {
@@ -141,6 +148,18 @@ struct Fixture {
         }
         return 31212.0;
     }
+    bool supports_block() {
+        auto result = program.get_seeds();
+        EXPECT_EQ(1u, result.num_features());
+        return result.resolve(0).supports_block();
+    }
+    std::vector<double> get_block(const std::vector<uint32_t> &docids) {
+        auto result = program.get_seeds();
+        EXPECT_EQ(1u, result.num_features());
+        std::vector<double> scores(docids.size());
+        result.resolve(0).as_numbers(docids, scores);
+        return scores;
+    }
     std::map<std::string, double> all(uint32_t docid = default_docid) {
         auto result = program.get_seeds();
         std::map<std::string, double> result_map;
@@ -448,6 +467,109 @@ TEST(RankProgramTest, fast_forest_gbdt_evaluation_is_pure)
     EXPECT_EQ(f1.final_executor_name(), "search::features::FastForestExecutor");
 }
 
+TEST(RankProgramTest, nested_ranking_expressions_are_not_inlined_by_default)
+{
+    Fixture f1;
+    f1.add_function("a", "ivalue(1)+docid").add_function("b", "rankingExpression(a)*2");
+    f1.add_expr("rank", "rankingExpression(b)+rankingExpression(a)").compile();
+    EXPECT_EQ(5u, f1.program.num_executors());
+    EXPECT_EQ(f1.get(5), 18.0);
+    EXPECT_EQ(f1.get(7), 24.0);
+}
+
+TEST(RankProgramTest, nested_ranking_expressions_can_be_inlined)
+{
+    Fixture f1;
+    f1.inline_expressions();
+    f1.add_function("a", "ivalue(1)+docid").add_function("b", "rankingExpression(a)*2");
+    f1.add_expr("rank", "rankingExpression(b)+1").compile();
+    EXPECT_EQ(3u, f1.program.num_executors());
+    EXPECT_EQ(0u, count_const_features(f1.program));
+    EXPECT_EQ(f1.get(5), 13.0);
+    EXPECT_EQ(f1.get(7), 17.0);
+}
+
+TEST(RankProgramTest, nested_ranking_expressions_referenced_more_than_once_are_not_inlined)
+{
+    Fixture f1;
+    f1.inline_expressions();
+    f1.add_function("a", "ivalue(1)+docid").add_function("b", "rankingExpression(a)*2");
+    f1.add_expr("rank", "rankingExpression(b)+rankingExpression(a)").compile();
+    // 'b' is inlined into 'rank', while 'a' is shared and still has its own executor
+    EXPECT_EQ(4u, f1.program.num_executors());
+    EXPECT_EQ(f1.get(5), 18.0);
+    EXPECT_EQ(f1.get(7), 24.0);
+
+    Fixture f2;
+    f2.inline_expressions();
+    f2.add_function("a", "ivalue(1)+docid");
+    f2.add_expr("rank", "rankingExpression(a)*rankingExpression(a)").compile();
+    EXPECT_EQ(4u, f2.program.num_executors());
+    EXPECT_EQ(f2.get(5), 36.0);
+    EXPECT_EQ(f2.get(7), 64.0);
+}
+
+TEST(RankProgramTest, fast_forest_expressions_are_not_inlined)
+{
+    Fixture f1;
+    f1.inline_expressions().use_fast_forest();
+    f1.add_function("forest", tree_expr).add_expr("rank", "rankingExpression(forest)*2").compile();
+    EXPECT_EQ(4u, f1.program.num_executors());
+    EXPECT_EQ(f1.get(), 42.0);
+}
+
+TEST(RankProgramTest, const_features_support_block_evaluation)
+{
+    Fixture f1;
+    f1.add("value(3)").compile();
+    EXPECT_TRUE(f1.supports_block());
+    EXPECT_EQ(f1.get_block({1, 5, 7}), std::vector<double>({3.0, 3.0, 3.0}));
+}
+
+TEST(RankProgramTest, compiled_expressions_support_block_evaluation)
+{
+    Fixture f1;
+    f1.lazy_expressions(false).add_expr("rank", "value(3)+docid*2").compile();
+    EXPECT_TRUE(f1.supports_block());
+    EXPECT_EQ(f1.get_block({1, 5, 7}), std::vector<double>({5.0, 13.0, 17.0}));
+    EXPECT_EQ(f1.get(5), 13.0);
+}
+
+TEST(RankProgramTest, nested_compiled_expressions_support_block_evaluation)
+{
+    Fixture f1;
+    f1.lazy_expressions(false).add_function("a", "docid+1");
+    f1.add_expr("rank", "rankingExpression(a)*2").compile();
+    EXPECT_TRUE(f1.supports_block());
+    EXPECT_EQ(f1.get_block({1, 5, 7}), std::vector<double>({4.0, 12.0, 16.0}));
+}
+
+TEST(RankProgramTest, block_evaluation_falls_back_to_single_documents)
+{
+    Fixture f1;
+    f1.lazy_expressions(false).add_expr("rank", "ivalue(3)+docid*2").compile();
+    EXPECT_FALSE(f1.supports_block());
+    EXPECT_EQ(f1.get_block({1, 5, 7}), std::vector<double>({5.0, 13.0, 17.0}));
+}
+
+TEST(RankProgramTest, fast_forest_gbdt_evaluation_supports_block_evaluation)
+{
+    Fixture f1;
+    f1.use_fast_forest().add_expr("rank", "if(docid<3,1.0,2.0)+if(docid<6,10.0,20.0)").compile();
+    EXPECT_EQ(f1.final_executor_name(), "search::features::FastForestExecutor");
+    EXPECT_TRUE(f1.supports_block());
+    EXPECT_EQ(f1.get_block({1, 5, 7}), std::vector<double>({11.0, 12.0, 22.0}));
+    EXPECT_EQ(f1.get(5), 12.0);
+}
+
+TEST(RankProgramTest, lazy_compiled_expressions_do_not_support_block_evaluation)
+{
+    Fixture f1;
+    f1.lazy_expressions(true).add_expr("rank", "value(3)+docid*2").compile();
+    EXPECT_FALSE(f1.supports_block());
+    EXPECT_EQ(f1.get_block({1, 5, 7}), std::vector<double>({5.0, 13.0, 17.0}));
+}
+
 TEST(RankProgramTest, rank_program_can_be_profiled)
 {
     Fixture f1;
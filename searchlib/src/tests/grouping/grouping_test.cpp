@@ -717,6 +717,54 @@ TEST("testAggregationGroupCapping")
 
 }
 
+TEST("testApproximateTopGroupsByCount")
+{
+    // Three frequent values interleaved with many values that only occur once.
+    std::vector<int64_t> values = { 1, 2, 3, 1, 2, 3 };
+    for (int64_t i(0); i < 30; i++) {
+        values.push_back(100 + i);
+        values.push_back(1 + (i % 3));
+    }
+    AggregationContext ctx;
+    IntAttrBuilder attr("attr");
+    for (uint32_t docid(0); docid < values.size(); docid++) {
+        attr.add(values[docid]);
+        ctx.result().add(docid, values.size() - docid);
+    }
+    ctx.add(attr.sp());
+
+    Grouping request;
+    request.setFirstLevel(0)
+           .setLastLevel(1)
+           .addLevel(std::move(GroupingLevel().setMaxGroups(3).setExpression(MU<AttributeNode>("attr"))
+                             .addAggregationResult(createAggr<CountAggregationResult>(MU<AttributeNode>("attr")))
+                             .addOrderBy(MU<AggregationRefNode>(0), false)));
+
+    Grouping exact = request;
+    ctx.setup(exact);
+    exact.aggregate(ctx.result().hits(), ctx.result().size());
+    EXPECT_EQUAL(3u, exact.getRoot().getChildrenSize());
+    EXPECT_EQUAL(0.0, exact.getLevels()[0].getApproximationError());
+
+    Grouping approximate = request;
+    approximate.setApproximationFactor(2);
+    ctx.setup(approximate);
+    approximate.aggregate(ctx.result().hits(), ctx.result().size());
+    EXPECT_EQUAL(exact.getRoot().asString(), approximate.getRoot().asString());
+    // Pruned down to 3 groups each time a new value arrives with 6 groups present,
+    // every time losing a group that had been counted once.
+    EXPECT_EQUAL(9.0, approximate.getLevels()[0].getApproximationError());
+
+    Grouping merged = exact;
+    merged.merge(approximate);
+    EXPECT_EQUAL(9.0, merged.getLevels()[0].getApproximationError());
+
+    // Continuing a cached grouping keeps the error of the levels aggregated earlier.
+    Grouping continued = request;
+    continued.mergePartial(approximate);
+    EXPECT_EQUAL(9.0, continued.getLevels()[0].getApproximationError());
+}
+
 //-----------------------------------------------------------------------------
 
 /**
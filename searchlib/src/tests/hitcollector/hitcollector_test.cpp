@@ -4,6 +4,7 @@
 #include <vespa/searchlib/fef/fef.h>
 #include <vespa/searchlib/queryeval/hitcollector.h>
 #include <vespa/vespalib/gtest/gtest.h>
+#include <random>
 
 #include <vespa/log/log.h>
 LOG_SETUP("hitcollector_test");
@@ -161,6 +162,62 @@ TEST(HitCollectorTest, testAddHit)
     testAddHit(400, 10, "numDocs==400"); // 400/32 = 12 which is bigger than 10.
 }
 
+void fill_random(HitCollector &hc, uint32_t numDocs)
+{
+    std::minstd_rand rnd(4711);
+    for (uint32_t docid = 0; docid < numDocs; ++docid) {
+        hc.addHit(docid, rnd() % 1000); // plenty of equal scores
+    }
+}
+
+void check_same_result(HitCollector &expected, HitCollector &actual, size_t numHits)
+{
+    EXPECT_EQ(extract(expected.getSortedHitSequence(numHits)), extract(actual.getSortedHitSequence(numHits)));
+    auto expRs = expected.getResultSet();
+    auto actRs = actual.getResultSet();
+    ASSERT_EQ(expRs->getArrayUsed(), actRs->getArrayUsed());
+    for (uint32_t i = 0; i < expRs->getArrayUsed(); ++i) {
+        EXPECT_EQ(expRs->getArray()[i].getDocId(), actRs->getArray()[i].getDocId());
+        EXPECT_EQ(expRs->getArray()[i].getRank(), actRs->getArray()[i].getRank());
+    }
+    ASSERT_TRUE(expRs->getBitOverflow() != nullptr);
+    ASSERT_TRUE(actRs->getBitOverflow() != nullptr);
+    EXPECT_TRUE(*expRs->getBitOverflow() == *actRs->getBitOverflow());
+}
+
+TEST(HitCollectorTest, batched_top_k_selection_gives_same_result_as_heap)
+{
+    constexpr uint32_t numDocs = 10000;
+    constexpr uint32_t maxHitsSize = 100;
+    for (uint32_t batchSize : {1u, 7u, 100u, 1000u, 20000u}) {
+        SCOPED_TRACE("batchSize=" + std::to_string(batchSize));
+        HitCollector heap(numDocs, maxHitsSize);
+        HitCollector batched(numDocs, maxHitsSize, batchSize);
+        fill_random(heap, numDocs);
+        fill_random(batched, numDocs);
+        check_same_result(heap, batched, 50);
+    }
+}
+
+TEST(HitCollectorTest, batched_top_k_selection_batch_size_is_at_least_heap_size)
+{
+    EXPECT_EQ(0u, HitCollector(10000, 100).getTopKBatchSize());
+    EXPECT_EQ(100u, HitCollector(10000, 100, 7).getTopKBatchSize());
+    EXPECT_EQ(1000u, HitCollector(10000, 100, 1000).getTopKBatchSize());
+    EXPECT_EQ(50u, HitCollector(50, 100, 7).getTopKBatchSize());
+}
+
+TEST(HitCollectorTest, batched_top_k_selection_with_batch_smaller_than_heap_gives_same_result_as_heap)
+{
+    constexpr uint32_t numDocs = 100000;
+    constexpr uint32_t maxHitsSize = 5000;
+    HitCollector heap(numDocs, maxHitsSize);
+    HitCollector batched(numDocs, maxHitsSize, 16);
+    fill_random(heap, numDocs);
+    fill_random(batched, numDocs);
+    check_same_result(heap, batched, 1000);
+}
+
 struct Fixture {
     HitCollector hc;
     BitVector::UP expBv;
@@ -62,7 +62,11 @@ private:
     int compareTemplate(AttributeVector *vector, uint32_t a, uint32_t b);
     int compare(AttributeVector *vector, AttrType type, uint32_t a, uint32_t b);
     void sortAndCheck(const std::vector<Spec> &spec, uint32_t num,
-                      uint32_t unique, const std::vector<std::string> &strValues);
+                      uint32_t unique, const std::vector<std::string> &strValues, uint32_t topn);
+    void sortAndCheck(const std::vector<Spec> &spec, uint32_t num,
+                      uint32_t unique, const std::vector<std::string> &strValues) {
+        sortAndCheck(spec, num, unique, strValues, num);
+    }
 public:
     MultilevelSortTest() { srand(time(nullptr)); }
     void testSort();
@@ -195,7 +199,7 @@ MultilevelSortTest::compare(AttributeVector *vector, AttrType type, uint32_t a,
 
 void
 MultilevelSortTest::sortAndCheck(const std::vector<Spec> &specs, uint32_t num,
-                                 uint32_t unique, const std::vector<std::string> &strValues)
+                                 uint32_t unique, const std::vector<std::string> &strValues, uint32_t topn)
 {
     VectorMap vec;
     // generate attribute vectors
@@ -257,15 +261,15 @@ MultilevelSortTest::sortAndCheck(const std::vector<Spec> &specs, uint32_t num,
     }
 
     vespalib::Timer timer;
-    sorter.sortResults(&hits[0], num, num);
+    sorter.sortResults(&hits[0], num, topn);
     LOG(info, "sort time = %" PRId64 " ms", vespalib::count_ms(timer.elapsed()));
 
-    std::vector<uint32_t> offsets(num + 1, 0);
-    auto buf = std::make_unique<char []>(sorter.getSortDataSize(0, num));
-    sorter.copySortData(0, num, &offsets[0], buf.get());
+    std::vector<uint32_t> offsets(topn + 1, 0);
+    auto buf = std::make_unique<char []>(sorter.getSortDataSize(0, topn));
+    sorter.copySortData(0, topn, &offsets[0], buf.get());
 
     // check results
-    for (uint32_t i = 0; i < num - 1; ++i) {
+    for (uint32_t i = 0; i < topn - 1; ++i) {
         for (const Spec & spec : specs) {
             int cmp = 0;
             if (spec._type == RANK) {
@@ -307,9 +311,9 @@ MultilevelSortTest::sortAndCheck(const std::vector<Spec> &specs, uint32_t num,
                      buf.get() + offsets[i], sorter._sortDataArray[i]._len);
         EXPECT_TRUE(cmp == 0);
     }
-    EXPECT_TRUE(sorter._sortDataArray[num-1]._len == (offsets[num] - offsets[num-1]));
-    int cmp = memcmp(&sorter._binarySortData[0] + sorter._sortDataArray[num-1]._idx,
-                 buf.get() + offsets[num-1], sorter._sortDataArray[num-1]._len);
+    EXPECT_TRUE(sorter._sortDataArray[topn-1]._len == (offsets[topn] - offsets[topn-1]));
+    int cmp = memcmp(&sorter._binarySortData[0] + sorter._sortDataArray[topn-1]._idx,
+                 buf.get() + offsets[topn-1], sorter._sortDataArray[topn-1]._len);
     EXPECT_TRUE(cmp == 0);
 }
 
@@ -348,6 +352,26 @@ void MultilevelSortTest::testSort()
         srand(time(nullptr));
         sortAndCheck(spec, 5000, 8, strValues);
     }
+    {
+        std::vector<Spec> spec;
+        spec.emplace_back("double", DOUBLE, false);
+        spec.emplace_back("string", STRING);
+        spec.emplace_back("int32", INT32);
+        spec.emplace_back("rank", RANK, false);
+        spec.emplace_back("docid", DOCID);
+
+        std::vector<std::string> strValues;
+        strValues.emplace_back("applications");
+        strValues.emplace_back("places");
+        strValues.emplace_back("system");
+
+        // only the top hits are sorted, and the last one has many hits with the same primary key
+        srand(12345);
+        sortAndCheck(spec, 5000, 4, strValues, 100);
+        sortAndCheck(spec, 5000, 4, strValues, 1);
+        srand(time(nullptr));
+        sortAndCheck(spec, 5000, 4, strValues, 100);
+    }
     {
         std::vector<std::string> none;
         uint32_t num = 50;
@@ -74,27 +74,18 @@ void benchmark(size_t iterations, size_t elems, const DistanceFunctionFactory &
 
 template<typename T>
 void benchmark(size_t iterations, size_t elems, const std::string & dist_functions) {
+    // Referencing vectors makes bfloat16 query vectors be used directly instead of converted to float
     if (dist_functions.find("euclid") != npos) {
-        if constexpr ( ! std::is_same<T, BFloat16>()) {
-            benchmark<T>(iterations, elems, EuclideanDistanceFunctionFactory<T>());
-        } else {
-            benchmark<BFloat16>(iterations, elems, EuclideanDistanceFunctionFactory<float>());
-        }
+        benchmark<T>(iterations, elems, EuclideanDistanceFunctionFactory<T>(true));
     }
     if (dist_functions.find("angular") != npos) {
-        if constexpr ( ! std::is_same<T, BFloat16>()) {
-            benchmark<T>(iterations, elems, AngularDistanceFunctionFactory<T>());
-        }
+        benchmark<T>(iterations, elems, AngularDistanceFunctionFactory<T>(true));
     }
     if (dist_functions.find("prenorm") != npos) {
-        if constexpr ( ! std::is_same<T, BFloat16>()) {
-            benchmark<T>(iterations, elems, PrenormalizedAngularDistanceFunctionFactory<T>());
-        }
+        benchmark<T>(iterations, elems, PrenormalizedAngularDistanceFunctionFactory<T>(true));
     }
     if (dist_functions.find("mips") != npos) {
-        if constexpr ( !std::is_same<T, BFloat16>()) {
-            benchmark<T>(iterations, elems, MipsDistanceFunctionFactory<T>());
-        }
+        benchmark<T>(iterations, elems, MipsDistanceFunctionFactory<T>(true));
     }
 }
 
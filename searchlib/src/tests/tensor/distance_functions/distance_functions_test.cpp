@@ -751,7 +751,7 @@ TEST(DistanceFunctionsTest, angular_can_reference_insertion_vector)
     expect_reference_insertion_vector<float>(1.0, DistanceMetric::Angular, CellType::FLOAT);
     expect_reference_insertion_vector<double>(1.0, DistanceMetric::Angular, CellType::DOUBLE);
     expect_reference_insertion_vector<Int8Float>(1.0, DistanceMetric::Angular, CellType::INT8);
-    expect_not_reference_insertion_vector<BFloat16>(1.0, DistanceMetric::Angular, CellType::BFLOAT16);
+    expect_reference_insertion_vector<BFloat16>(1.0, DistanceMetric::Angular, CellType::BFLOAT16);
 }
 
 TEST(DistanceFunctionsTest, prenormalized_angular_can_reference_insertion_vector)
@@ -759,7 +759,7 @@ TEST(DistanceFunctionsTest, prenormalized_angular_can_reference_insertion_vector
     expect_reference_insertion_vector<float>(1.0, DistanceMetric::PrenormalizedAngular, CellType::FLOAT);
     expect_reference_insertion_vector<double>(1.0, DistanceMetric::PrenormalizedAngular, CellType::DOUBLE);
     expect_reference_insertion_vector<Int8Float>(1.0, DistanceMetric::PrenormalizedAngular, CellType::INT8);
-    expect_not_reference_insertion_vector<BFloat16>(1.0, DistanceMetric::PrenormalizedAngular, CellType::BFLOAT16);
+    expect_reference_insertion_vector<BFloat16>(1.0, DistanceMetric::PrenormalizedAngular, CellType::BFLOAT16);
 }
 
 TEST(DistanceFunctionsTest, euclidean_can_reference_insertion_vector)
@@ -767,7 +767,7 @@ TEST(DistanceFunctionsTest, euclidean_can_reference_insertion_vector)
     expect_reference_insertion_vector<float>(2.0, DistanceMetric::Euclidean, CellType::FLOAT);
     expect_reference_insertion_vector<double>(2.0, DistanceMetric::Euclidean, CellType::DOUBLE);
     expect_reference_insertion_vector<Int8Float>(2.0, DistanceMetric::Euclidean, CellType::INT8);
-    expect_not_reference_insertion_vector<BFloat16>(2.0, DistanceMetric::Euclidean, CellType::BFLOAT16);
+    expect_reference_insertion_vector<BFloat16>(2.0, DistanceMetric::Euclidean, CellType::BFLOAT16);
 }
 
 TEST(DistanceFunctionsTest, dotproduct_can_reference_insertion_vector)
@@ -775,7 +775,7 @@ TEST(DistanceFunctionsTest, dotproduct_can_reference_insertion_vector)
     expect_reference_insertion_vector<float>(0.0, DistanceMetric::Dotproduct, CellType::FLOAT);
     expect_reference_insertion_vector<double>(0.0, DistanceMetric::Dotproduct, CellType::DOUBLE);
     expect_reference_insertion_vector<Int8Float>(0.0, DistanceMetric::Dotproduct, CellType::INT8);
-    expect_not_reference_insertion_vector<BFloat16>(0.0, DistanceMetric::Dotproduct, CellType::BFLOAT16);
+    expect_reference_insertion_vector<BFloat16>(0.0, DistanceMetric::Dotproduct, CellType::BFLOAT16);
 }
 
 TEST(DistanceFunctionsTest, hamming_can_reference_insertion_vector)
@@ -786,5 +786,60 @@ TEST(DistanceFunctionsTest, hamming_can_reference_insertion_vector)
     expect_not_reference_insertion_vector<BFloat16>(2.0, DistanceMetric::Hamming, CellType::BFLOAT16);
 }
 
+void
+expect_bfloat16_same_as_float(DistanceMetric metric)
+{
+    SCOPED_TRACE(testing::Message() << "metric=" << static_cast<int>(metric));
+    // Values are exactly representable in bfloat16, length exercises both vector loop and tail
+    std::vector<BFloat16> bf16_a, bf16_b;
+    std::vector<float> flt_a, flt_b;
+    for (uint32_t i = 0; i < 71; ++i) {
+        float a = (int(i % 7) - 3) * 0.25f;
+        float b = (int(i % 5) - 2) * 0.5f;
+        bf16_a.emplace_back(a);
+        bf16_b.emplace_back(b);
+        flt_a.push_back(a);
+        flt_b.push_back(b);
+    }
+    auto bf16_factory = make_distance_function_factory(metric, CellType::BFLOAT16);
+    auto flt_factory = make_distance_function_factory(metric, CellType::FLOAT);
+    EXPECT_DOUBLE_EQ(flt_factory->for_insertion_vector(t(flt_a))->calc(t(flt_b)),
+                     bf16_factory->for_insertion_vector(t(bf16_a))->calc(t(bf16_b)));
+    // bfloat16 query vector uses bfloat16 cells directly
+    EXPECT_DOUBLE_EQ(flt_factory->for_query_vector(t(flt_a))->calc(t(flt_b)),
+                     bf16_factory->for_query_vector(t(bf16_a))->calc(t(bf16_b)));
+    // float query vector is not converted to bfloat16
+    EXPECT_DOUBLE_EQ(flt_factory->for_query_vector(t(flt_a))->calc(t(flt_b)),
+                     bf16_factory->for_query_vector(t(flt_a))->calc(t(bf16_b)));
+}
+
+TEST(DistanceFunctionsTest, bfloat16_cells_give_same_distance_as_float_cells)
+{
+    expect_bfloat16_same_as_float(DistanceMetric::Angular);
+    expect_bfloat16_same_as_float(DistanceMetric::PrenormalizedAngular);
+    expect_bfloat16_same_as_float(DistanceMetric::Euclidean);
+    expect_bfloat16_same_as_float(DistanceMetric::Dotproduct);
+}
+
+TEST(DistanceFunctionsTest, calc_batch_gives_same_distances_as_calc)
+{
+    std::vector<float> lhs{1.0, 2.0, 3.0};
+    std::vector<std::vector<float>> vectors{{0.0, 0.0, 0.0}, {1.0, 2.0, 3.0}, {-1.0, 0.5, 2.0}, {3.0, 2.0, 1.0}};
+    std::vector<TypedCells> rhs;
+    for (const auto& v : vectors) {
+        rhs.push_back(t(v));
+    }
+    for (auto metric : {DistanceMetric::Angular, DistanceMetric::PrenormalizedAngular, DistanceMetric::Euclidean,
+                        DistanceMetric::Dotproduct, DistanceMetric::Hamming}) {
+        SCOPED_TRACE(testing::Message() << "metric=" << static_cast<int>(metric));
+        auto func = make_distance_function_factory(metric, CellType::FLOAT)->for_query_vector(t(lhs));
+        std::vector<double> distances(rhs.size());
+        func->calc_batch(rhs, distances);
+        for (size_t i = 0; i < rhs.size(); ++i) {
+            EXPECT_EQ(func->calc(rhs[i]), distances[i]);
+        }
+    }
+}
+
 GTEST_MAIN_RUN_ALL_TESTS()
 
@@ -35,6 +35,8 @@ using namespace vespalib::slime;
 using vespalib::Slime;
 using search::BitVector;
 using search::BufferWriter;
+using vespalib::eval::CellType;
+using vespalib::eval::TypedCells;
 using vespalib::eval::get_cell_type;
 using vespalib::eval::ValueType;
 using vespalib::datastore::CompactionSpec;
@@ -210,12 +212,12 @@ public:
         return std::make_unique<MyDistanceFunctionFactory>(dff_real());
     }
 
-    void init(bool heuristic_select_neighbors) {
+    void init(bool heuristic_select_neighbors, bool quantize_vectors = false) {
         auto generator = std::make_unique<LevelGenerator>();
         level_generator = generator.get();
         index = std::make_unique<IndexType>(vectors, dff(),
                                             std::move(generator),
-                                            HnswIndexConfig(5, 2, 10, 0, heuristic_select_neighbors));
+                                            HnswIndexConfig(5, 2, 10, 0, heuristic_select_neighbors, quantize_vectors));
     }
     void add_document(uint32_t docid, uint32_t max_level = 0) {
         level_generator->level = max_level;
@@ -928,6 +930,65 @@ TYPED_TEST(HnswIndexTest, hnsw_graph_can_be_saved_and_loaded)
     this->check_savetest_index("after load");
 }
 
+TYPED_TEST(HnswIndexTest, graph_is_searched_with_quantized_vectors_and_candidates_are_reranked)
+{
+    this->init(false, true);
+    auto mem_before = this->memory_usage();
+    for (uint32_t docid = 1; docid < 10; ++docid) {
+        this->add_document(docid);
+    }
+    EXPECT_LT(mem_before.usedBytes(), this->memory_usage().usedBytes());
+    this->expect_top_3(5, {5, 6, 2});
+    this->expect_top_3(8, {8, 4, 3});
+    this->expect_top_3(9, {9, 7, 3});
+
+    // Distances are calculated using the original vectors, not the quantized ones.
+    auto qv = this->vectors.get_vector(9, 0);
+    auto df = this->index->distance_function_factory().for_query_vector(qv);
+    auto hits = this->index->find_top_k(3, *df, 3, this->_doom->get_doom(), 10000.0);
+    ASSERT_EQ(3, hits.size());
+    EXPECT_EQ(NearestNeighborIndex::Neighbor(3, 8.0), hits[0]);
+    EXPECT_EQ(NearestNeighborIndex::Neighbor(7, 1.0), hits[1]);
+    EXPECT_EQ(NearestNeighborIndex::Neighbor(9, 0.0), hits[2]);
+}
+
+TYPED_TEST(HnswIndexTest, quantized_vectors_are_freed_when_nodes_are_removed)
+{
+    this->init(false, true);
+    for (uint32_t docid = 1; docid < 10; ++docid) {
+        this->add_document(docid);
+    }
+    auto mem_before = this->commit_and_update_stat();
+    this->remove_document(9);
+    this->remove_document(5);
+    this->commit_and_update_stat();
+    this->add_document(5);
+    this->add_document(9);
+    auto mem_after = this->commit_and_update_stat();
+    EXPECT_EQ(mem_before.usedBytes(), mem_after.usedBytes());
+    this->expect_top_3(5, {5, 6, 2});
+    this->expect_top_3(9, {9, 7, 3});
+}
+
+TEST(QuantizedVectorStoreTest, node_without_stored_vector_is_dequantized_as_non_existing_value)
+{
+    QuantizedVectorStore store;
+    std::vector<float> cells = {3.0, -6.0};
+    std::vector<float> empty_cells(2);
+    store.set(1, TypedCells(std::span<const float>(cells)));
+    store.set(3, TypedCells::create_non_existing_attribute_value(empty_cells.data(), CellType::FLOAT, 2));
+    QuantizedVectorReader reader(store);
+    reader.reserve(2);
+    auto dequantized = reader.dequantize(1, 0);
+    ASSERT_FALSE(dequantized.non_existing_attribute_value());
+    auto values = dequantized.typify<float>();
+    EXPECT_NEAR(3.0, values[0], 0.05);
+    EXPECT_NEAR(-6.0, values[1], 0.05);
+    EXPECT_TRUE(reader.dequantize(2, 1).non_existing_attribute_value());
+    EXPECT_TRUE(reader.dequantize(3, 1).non_existing_attribute_value());
+    store.prefetch(3);
+}
+
 TYPED_TEST(HnswIndexTest, search_during_remove)
 {
     this->init(false);
@@ -908,6 +908,29 @@ TEST("testSync") {
     EXPECT_EQUAL(syncedTo, TOTAL_NUM_ENTRIES);
 }
 
+TEST("test that acks are released after group commit with fsync") {
+    const unsigned int NUM_PACKETS = 100;
+    const unsigned int NUM_ENTRIES = 10;
+    const unsigned int TOTAL_NUM_ENTRIES = NUM_PACKETS * NUM_ENTRIES;
+
+    DummyFileHeaderContext fileHeaderContext;
+    test::DirectoryHandler testDir("test12");
+    TLS tlss(testDir.getDir(), 18377, ".", fileHeaderContext,
+             createDomainConfig(0x10000).setFSyncOnCommit(true).setGroupCommitWindow(1ms));
+    TransLogClient tls(tlss.transport, "tcp/localhost:18377");
+
+    createDomainTest(tls, "groupcommit", 0);
+    auto s1 = openDomainTest(tls, "groupcommit");
+    // Returns when all acks have been released, i.e. everything is synced.
+    fillDomainTest(tlss.tls, "groupcommit", NUM_PACKETS, NUM_ENTRIES);
+    auto domainStats = tlss.tls.getDomainStats();
+    EXPECT_EQUAL(TOTAL_NUM_ENTRIES, domainStats["groupcommit"].range.to());
+    SerialNum syncedTo(0);
+    EXPECT_TRUE(s1->sync(TOTAL_NUM_ENTRIES, syncedTo));
+    EXPECT_EQUAL(syncedTo, TOTAL_NUM_ENTRIES);
+    checkFilledDomainTest(*s1, TOTAL_NUM_ENTRIES);
+}
+
 TEST("test truncate on version mismatch") {
     const unsigned int NUM_PACKETS = 3;
     const unsigned int NUM_ENTRIES = 4;
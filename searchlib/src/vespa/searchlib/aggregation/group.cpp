@@ -2,6 +2,8 @@
 
 #include "group.h"
 #include "grouping.h"
+#include "countaggregationresult.h"
+#include "sumaggregationresult.h"
 #include <vespa/searchlib/expression/aggregationrefnode.h>
 
 #include <vespa/vespalib/objects/visit.hpp>
@@ -100,6 +102,9 @@ Group::Value::groupSingle(const ResultNode & selectResult, HitRank rank, const G
     Group * group(nullptr);
     auto found = childMap.find(selectResult);
     if (found == childMap.end()) { // group not present in child map
+        if (level.needPruning(childMap.size())) {
+            level.addApproximationError(pruneChildren(level.getPrecision()));
+        }
         if (level.allowMoreGroups(childMap.size())) {
             group = new Group(level.getGroupPrototype());
             group->setId(selectResult);
@@ -116,6 +121,26 @@ Group::Value::groupSingle(const ResultNode & selectResult, HitRank rank, const G
     return group;
 }
 
+double
+Group::Value::pruneChildren(uint32_t keep)
+{
+    std::nth_element(_children, _children + keep, _children + getChildrenSize(), SortByGroupRank());
+    // The best of the evicted groups holds the largest count or sum that is lost.
+    uint32_t index = std::abs(getOrderBy(0)) - 1;
+    double lost = _children[keep]->_aggr.expr(index).getResult()->getFloat();
+    for (size_t i(keep), m(getChildrenSize()); i < m; i++) {
+        destruct(_children[i]);
+        reset(_children[i]);
+    }
+    setChildrenSize(keep);
+    GroupHash & childMap = *_childInfo._childMap;
+    childMap.clear();
+    for (uint32_t i(0); i < keep; i++) {
+        childMap.insert(i);
+    }
+    return lost;
+}
+
 void
 Group::merge(const GroupingLevelList &levels, uint32_t firstLevel, uint32_t currentLevel, Group &b) {
     bool frozen = (currentLevel < firstLevel);    // is this level frozen ?
@@ -521,6 +546,21 @@ Group::Value::needResort() const
     return resort;
 }
 
+bool
+Group::Value::isRankedByGrowingAggregate() const
+{
+    if ((getOrderBySize() == 0) || (getOrderBy(0) > 0)) {
+        return false;
+    }
+    const ExpressionNode & orderBy = expr(std::abs(getOrderBy(0)) - 1);
+    if ( ! orderBy.inherits(AggregationRefNode::classId)) {
+        return false;
+    }
+    const ExpressionNode * aggr = static_cast<const AggregationRefNode &>(orderBy).getExpression();
+    return (aggr != nullptr) &&
+           (aggr->inherits(CountAggregationResult::classId) || aggr->inherits(SumAggregationResult::classId));
+}
+
 void
 Group::Value::assertIdOrder() const {
     if (getChildrenSize() > 1) {
@@ -81,6 +81,7 @@ public:
         void mergeCollectors(const Value & rhs);
         void execute();
         bool needResort() const;
+        bool isRankedByGrowingAggregate() const;
         void assertIdOrder() const;
         void visitMembers(vespalib::ObjectVisitor &visitor) const;
         vespalib::Serializer & serialize(vespalib::Serializer & os) const;
@@ -93,6 +94,7 @@ public:
         void postMerge(const std::vector<GroupingLevel> &levels, uint32_t firstLevel, uint32_t currentLevel);
         void partialCopy(const Value & rhs);
         VESPA_DLL_LOCAL Group * groupSingle(const ResultNode & selectResult, HitRank rank, const GroupingLevel & level);
+        VESPA_DLL_LOCAL double pruneChildren(uint32_t keep);
 
         GroupList groups() const noexcept { return _children; }
         void addChild(Group * child);
@@ -232,6 +234,11 @@ public:
      * Then all hits must be processed and should be done before any hit sorting.
      */
     bool needResort() const { return _aggr.needResort(); }
+    /**
+     * Tells if the primary order of this group is a descending count or sum aggregation,
+     * which only grows as more hits are aggregated.
+     */
+    bool isRankedByGrowingAggregate() const { return _aggr.isRankedByGrowingAggregate(); }
 
     void selectMembers(const vespalib::ObjectPredicate &predicate, vespalib::ObjectOperation &operation) override;
 
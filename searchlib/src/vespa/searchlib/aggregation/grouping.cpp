@@ -163,6 +163,9 @@ Grouping::prune(const Grouping & b)
 void
 Grouping::mergePartial(const Grouping & b)
 {
+    for (size_t i(0), m(std::min(_levels.size(), b._levels.size())); i < m; i++) {
+        _levels[i].mergeApproximationError(b._levels[i]);
+    }
     _root.mergePartial(_levels, _firstLevel, _lastLevel, 0, b._root);
 }
 
@@ -170,6 +173,9 @@ Grouping::mergePartial(const Grouping & b)
 void
 Grouping::merge(Grouping & b)
 {
+    for (size_t i(0), m(std::min(_levels.size(), b._levels.size())); i < m; i++) {
+        _levels[i].mergeApproximationError(b._levels[i]);
+    }
     _root.merge(_levels, _firstLevel, 0, b._root);
 }
 
@@ -324,6 +330,13 @@ Grouping::needResort() const
     return (resort && getTopN() <= 0);
 }
 
+void
+Grouping::setApproximationFactor(uint32_t factor)
+{
+    for (GroupingLevel & level : _levels) {
+        level.setApproximationFactor(factor);
+    }
+}
 
 Serializer &
 Grouping::onSerialize(Serializer & os) const
@@ -61,6 +61,11 @@ public:
     const GroupingLevelList &getLevels() const noexcept { return _levels; }
     const Group &getRoot()   const noexcept { return _root; }
     bool needResort() const;
+    /**
+     * Enables approximate top groups on all levels where it applies,
+     * see GroupingLevel::setApproximationFactor.
+     */
+    void setApproximationFactor(uint32_t factor);
 
     GroupingLevelList &levels() noexcept { return _levels; }
     Group &root() noexcept { return _root; }
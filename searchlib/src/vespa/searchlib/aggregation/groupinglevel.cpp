@@ -4,6 +4,7 @@
 #include "grouping.h"
 #include <vespa/searchlib/expression/resultvector.h>
 #include <vespa/searchlib/expression/current_index_setup.h>
+#include <algorithm>
 
 namespace search::aggregation {
 
@@ -18,6 +19,9 @@ GroupingLevel::GroupingLevel() noexcept
       _precision(-1),
       _isOrdered(false),
       _frozen(false),
+      _approximationFactor(0),
+      _pruneLimit(0),
+      _approximationError(0),
       _currentIndex(),
       _classify(),
       _collect(),
@@ -50,6 +54,10 @@ GroupingLevel::visitMembers(vespalib::ObjectVisitor &visitor) const
     visit(visitor, "precision", _precision);
     visit(visitor, "classify",  _classify);
     visit(visitor, "collect",   _collect);
+    if (_approximationFactor > 0) {
+        visit(visitor, "approximationFactor", _approximationFactor);
+        visit(visitor, "approximationError", _approximationError);
+    }
 }
 
 void
@@ -115,6 +123,10 @@ GroupingLevel::prepare(const Grouping * grouping, uint32_t level, bool isOrdered
 {
     _isOrdered = isOrdered_;
     _frozen = level < grouping->getFirstLevel();
+    _pruneLimit = 0;
+    if ((_approximationFactor > 0) && !_frozen && (_precision > 0) && _collect.isRankedByGrowingAggregate()) {
+        _pruneLimit = uint64_t(std::max(_approximationFactor, 2u)) * _precision;
+    }
     if (_classify.getResult()->inherits(ResultNodeVector::classId)) {
        _grouper.reset(new MultiValueGrouper(&_currentIndex, grouping, level));
     } else {
@@ -79,6 +79,9 @@ private:
     int64_t        _precision;
     bool           _isOrdered;
     bool           _frozen;
+    uint32_t       _approximationFactor;  // Local setting, not serialized.
+    uint64_t       _pruneLimit;
+    mutable double _approximationError;
     CurrentIndex   _currentIndex;
     ExpressionTree _classify;
     Group          _collect;
@@ -104,6 +107,15 @@ public:
         return *this;
     }
     GroupingLevel & freeze() { _frozen = true; return *this; }
+    /**
+     * Enables approximate top groups when this level is ordered by a descending count or sum.
+     * Instead of materializing all groups before pruning, the groups are pruned down to
+     * the precision each time there are factor (at least 2) times precision of them.
+     * A group may then have lost hits aggregated before it was last pruned, bounded
+     * by getApproximationError(). Sums are assumed to be over non-negative values.
+     * 0 means exact grouping.
+     */
+    GroupingLevel &setApproximationFactor(uint32_t factor) { _approximationFactor = factor; return *this; }
     GroupingLevel &setPresicion(int64_t precision) { _precision = precision; return *this; }
     GroupingLevel &setExpression(ExpressionNode::UP root) { _classify = std::move(root); return *this; }
     GroupingLevel &addResult(ExpressionNode::UP result) { _collect.addResult(std::move(result)); return *this; }
@@ -116,6 +128,15 @@ public:
     int64_t getPrecision() const noexcept { return _precision; }
     bool        isFrozen() const noexcept { return _frozen; }
     bool    allowMoreGroups(size_t sz) const noexcept { return (!_frozen && (!_isOrdered || (sz < (uint64_t)_precision))); }
+    bool        needPruning(size_t sz) const noexcept { return (_pruneLimit != 0) && (sz >= _pruneLimit); }
+    uint32_t getApproximationFactor() const noexcept { return _approximationFactor; }
+    /**
+     * Upper bound of the count or sum that any group on this level may be missing
+     * due to pruning during aggregation. 0 when the result is exact.
+     */
+    double   getApproximationError() const noexcept { return _approximationError; }
+    void     addApproximationError(double error) const noexcept { _approximationError += error; }
+    void   mergeApproximationError(const GroupingLevel & b) noexcept { _approximationError += b._approximationError; }
     const ExpressionTree & getExpression() const { return _classify; }
     ExpressionTree & getExpression() { return _classify; }
     const       Group &getGroupPrototype() const { return _collect; }
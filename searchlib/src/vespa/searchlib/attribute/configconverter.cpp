@@ -144,7 +144,8 @@ ConfigConverter::convert(const AttributesConfig::Attribute & cfg)
     if (cfg.index.hnsw.enabled) {
         retval.set_hnsw_index_params(HnswIndexParams(cfg.index.hnsw.maxlinkspernode,
                                                      cfg.index.hnsw.neighborstoexploreatinsert,
-                                                     dm, cfg.index.hnsw.multithreadedindexing));
+                                                     dm, cfg.index.hnsw.multithreadedindexing,
+                                                     cfg.index.hnsw.quantizevectors && cfg.paged));
     }
     if (retval.basicType().type() == BasicType::Type::TENSOR) {
         if (!cfg.tensortype.empty()) {
@@ -426,9 +426,152 @@ public:
 };
 
 
+namespace {
+
+/**
+ * A hit together with the value of its primary sort key, converted to an
+ * unsigned integer ordered the same way as the serialized sort data.
+ */
+struct KeyedHit
+{
+    uint64_t  _key;
+    RankedHit _hit;
+};
+
+struct KeyedHitRadix
+{
+    uint64_t operator () (const KeyedHit & a) const noexcept { return a._key; }
+};
+
+struct KeyedHitLess
+{
+    bool operator () (const KeyedHit & a, const KeyedHit & b) const noexcept { return a._key < b._key; }
+};
+
+using KeyedHitArray = std::vector<KeyedHit, vespalib::allocator_large<KeyedHit>>;
+
+bool
+hasKeyColumn(const FastS_SortSpec::VectorRef & vec)
+{
+    switch (vec._type) {
+    case FastS_SortSpec::ASC_RANK:
+    case FastS_SortSpec::DESC_RANK:
+        return true;
+    case FastS_SortSpec::ASC_DOCID:
+    case FastS_SortSpec::DESC_DOCID:
+        return (vec._vector == nullptr);
+    default:
+        break;
+    }
+    if (vec._vector->hasMultiValue()) {
+        return false;
+    }
+    switch (vec._vector->getBasicType()) {
+    case search::attribute::BasicType::INT8:
+    case search::attribute::BasicType::INT16:
+    case search::attribute::BasicType::INT32:
+    case search::attribute::BasicType::INT64:
+    case search::attribute::BasicType::FLOAT:
+    case search::attribute::BasicType::DOUBLE:
+        return true;
+    default:
+        return false;
+    }
+}
+
+template <typename C, typename GetValue>
+void
+fillKeyColumn(KeyedHit * column, const RankedHit * hits, uint32_t n, GetValue getValue)
+{
+    for (uint32_t i = 0; i < n; ++i) {
+        column[i]._key = C::convert(getValue(hits[i]));
+        column[i]._hit = hits[i];
+    }
+}
+
+void
+fillKeyColumn(KeyedHit * column, const FastS_SortSpec::VectorRef & vec, const RankedHit * hits, uint32_t n)
+{
+    const IAttributeVector * attr = vec._vector;
+    auto rank = [](const RankedHit & hit) noexcept { return hit.getRank(); };
+    // The partition id is the same for all hits and is thus left out of the key.
+    auto docId = [](const RankedHit & hit) noexcept { return hit.getDocId(); };
+    // Widening integer and float values keeps their order.
+    auto intValue = [attr](const RankedHit & hit) { return int64_t(attr->getInt(hit.getDocId())); };
+    auto floatValue = [attr](const RankedHit & hit) { return attr->getFloat(hit.getDocId()); };
+    switch (vec._type) {
+    case FastS_SortSpec::ASC_RANK:
+        return fillKeyColumn<convertForSort<search::HitRank, true>>(column, hits, n, rank);
+    case FastS_SortSpec::DESC_RANK:
+        return fillKeyColumn<convertForSort<search::HitRank, false>>(column, hits, n, rank);
+    case FastS_SortSpec::ASC_DOCID:
+        return fillKeyColumn<convertForSort<uint32_t, true>>(column, hits, n, docId);
+    case FastS_SortSpec::DESC_DOCID:
+        return fillKeyColumn<convertForSort<uint32_t, false>>(column, hits, n, docId);
+    case FastS_SortSpec::ASC_VECTOR:
+        return attr->isFloatingPointType()
+            ? fillKeyColumn<convertForSort<double, true>>(column, hits, n, floatValue)
+            : fillKeyColumn<convertForSort<int64_t, true>>(column, hits, n, intValue);
+    case FastS_SortSpec::DESC_VECTOR:
+        return attr->isFloatingPointType()
+            ? fillKeyColumn<convertForSort<double, false>>(column, hits, n, floatValue)
+            : fillKeyColumn<convertForSort<int64_t, false>>(column, hits, n, intValue);
+    }
+}
+
+}
+
+/**
+ * Sorts the hits on a column with the values of the primary sort key, without
+ * serializing any sort data. Sort data for all keys is only generated for the
+ * top hits, and used to order hits with equal primary key.
+ *
+ * Returns false if the primary sort key has no numeric column representation.
+ */
+bool
+FastS_SortSpec::sortOnPrimaryKeyColumn(RankedHit a[], uint32_t n, uint32_t topn)
+{
+    if (_vectors.empty() || !hasKeyColumn(_vectors[0])) {
+        return false;
+    }
+    KeyedHitArray column(n);
+    fillKeyColumn(column.data(), _vectors[0], a, n);
+    search::ShiftBasedRadixSorter<KeyedHit, KeyedHitRadix, KeyedHitLess, 56>::
+        radix_sort(KeyedHitRadix(), KeyedHitLess(), column.data(), n, 16, topn);
+    for (uint32_t i(0); i < n; ++i) {
+        a[i] = column[i]._hit;
+    }
+
+    // Hits having the same primary key as the last wanted hit are placed right after it.
+    uint32_t end = std::min(n, topn);
+    while ((end > 0) && (end < n) && (column[end]._key == column[end - 1]._key)) {
+        ++end;
+    }
+    initSortData(a, end);
+    if ((_vectors.size() < 2) || _doom.hard_doom()) {
+        return true;
+    }
+    SortData * sortData = _sortDataArray.data();
+    StdSortDataCompare compare(_binarySortData.data());
+    for (uint32_t first(0), last(0); first < end; first = last) {
+        for (last = first + 1; (last < end) && (column[last]._key == column[first]._key); ++last) { }
+        if ((last - first) > 1) {
+            std::sort(sortData + first, sortData + last, compare);
+            for (uint32_t i(first); i < last; ++i) {
+                a[i]._rankValue = sortData[i]._rankValue;
+                a[i]._docId = sortData[i]._docId;
+            }
+        }
+    }
+    return true;
+}
+
 void
 FastS_SortSpec::sortResults(RankedHit a[], uint32_t n, uint32_t topn)
 {
+    if (sortOnPrimaryKeyColumn(a, n, topn)) {
+        return;
+    }
     initSortData(a, n);
     {
         SortData * sortData = _sortDataArray.data();
@@ -107,6 +107,7 @@ private:
     bool Add(search::attribute::IAttributeContext & vecMan, const search::common::SortInfo & sInfo);
     void initSortData(const search::RankedHit *a, uint32_t n);
     int initSortData(const VectorRef & vec, const search::RankedHit & hit, size_t offset);
+    bool sortOnPrimaryKeyColumn(search::RankedHit a[], uint32_t n, uint32_t topn);
 
 public:
     FastS_SortSpec(const FastS_SortSpec &) = delete;
@@ -17,6 +17,11 @@ TuneFileRandRead::setFromConfig(const enum TuneControlConfig::Io & tuneControlCo
         case TuneControlConfig::Io::MMAP:     _tuneControl = MMAP; break;
         default:                          _tuneControl = NORMAL; break;
     }
+    if constexpr (requires { TuneControlConfig::Io::URING; }) {
+        if (tuneControlConfig == TuneControlConfig::Io::URING) {
+            setWantUring();
+        }
+    }
     setFromMmapConfig(mmapFlags);
 }
 
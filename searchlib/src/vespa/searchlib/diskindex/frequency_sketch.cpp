@@ -0,0 +1,77 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "frequency_sketch.h"
+#include <algorithm>
+#include <bit>
+
+namespace search::diskindex {
+
+namespace {
+
+constexpr uint64_t row_seeds[4] = {
+    0x9e3779b97f4a7c15ull, 0xc2b2ae3d27d4eb4full, 0x165667b19e3779f9ull, 0xd6e8feb86659fd93ull
+};
+
+}
+
+FrequencySketch::FrequencySketch(size_t min_counters)
+    : _counters(std::bit_ceil(std::max(min_counters, size_t(64)))),
+      _mask(_counters.size() - 1),
+      _sample_size(10 * _counters.size()),
+      _additions(0)
+{
+}
+
+FrequencySketch::~FrequencySketch() = default;
+
+size_t
+FrequencySketch::index(uint64_t hash, uint32_t row) const noexcept
+{
+    uint64_t h = (hash + row_seeds[row]) * row_seeds[(row + 1) % num_rows];
+    h ^= (h >> 29);
+    return h & _mask;
+}
+
+void
+FrequencySketch::add(uint64_t hash) noexcept
+{
+    size_t idx[num_rows];
+    uint8_t min_count = max_count;
+    for (uint32_t row = 0; row < num_rows; ++row) {
+        idx[row] = index(hash, row);
+        min_count = std::min(min_count, _counters[idx[row]].load(std::memory_order_relaxed));
+    }
+    if (min_count < max_count) {
+        // Conservative update: only bump the counters that define the estimate
+        for (uint32_t row = 0; row < num_rows; ++row) {
+            auto& counter = _counters[idx[row]];
+            if (counter.load(std::memory_order_relaxed) == min_count) {
+                counter.store(min_count + 1, std::memory_order_relaxed);
+            }
+        }
+    }
+    if (_additions.fetch_add(1, std::memory_order_relaxed) + 1 == _sample_size) {
+        age();
+    }
+}
+
+uint32_t
+FrequencySketch::estimate(uint64_t hash) const noexcept
+{
+    uint8_t min_count = max_count;
+    for (uint32_t row = 0; row < num_rows; ++row) {
+        min_count = std::min(min_count, _counters[index(hash, row)].load(std::memory_order_relaxed));
+    }
+    return min_count;
+}
+
+void
+FrequencySketch::age() noexcept
+{
+    for (auto& counter : _counters) {
+        counter.store(counter.load(std::memory_order_relaxed) >> 1, std::memory_order_relaxed);
+    }
+    _additions.store(_sample_size / 2, std::memory_order_relaxed);
+}
+
+}
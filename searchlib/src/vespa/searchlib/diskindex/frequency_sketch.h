@@ -0,0 +1,41 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace search::diskindex {
+
+/*
+ * Approximate access frequency counter (count-min sketch) used by the
+ * posting list cache to decide if a posting list read on cache miss is
+ * popular enough to be allowed to evict other posting lists (TinyLFU).
+ *
+ * Counters saturate at 15. When the number of additions reaches the
+ * sample size, all counters are halved to let old popularity fade.
+ * Counters are updated with relaxed atomics, concurrent updates might
+ * be lost, which is acceptable for an approximation.
+ */
+class FrequencySketch {
+    static constexpr uint32_t num_rows = 4;
+    static constexpr uint8_t max_count = 15;
+
+    std::vector<std::atomic<uint8_t>> _counters;
+    uint64_t                          _mask;
+    uint64_t                          _sample_size;
+    std::atomic<uint64_t>             _additions;
+
+    size_t index(uint64_t hash, uint32_t row) const noexcept;
+    void age() noexcept;
+public:
+    explicit FrequencySketch(size_t min_counters);
+    ~FrequencySketch();
+    void add(uint64_t hash) noexcept;
+    uint32_t estimate(uint64_t hash) const noexcept;
+    size_t num_counters() const noexcept { return _counters.size(); }
+    uint64_t sample_size() const noexcept { return _sample_size; }
+};
+
+}
@@ -1,35 +1,83 @@
 // Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
 
 #include "posting_list_cache.h"
+#include "frequency_sketch.h"
 #include <vespa/searchlib/index/dictionary_lookup_result.h>
 #include <vespa/searchlib/index/postinglistfile.h>
 #include <vespa/vespalib/stllike/cache.hpp>
-#include <iostream>
+#include <cstdlib>
+#include <cstring>
 
 using search::index::DictionaryLookupResult;
 using search::index::PostingListHandle;
 
 namespace search::diskindex {
 
+namespace {
+
+// Space after posting list used by decode prefetch, cf. ZcPosOccRandRead::read_posting_list
+constexpr size_t decode_prefetch_padding = 16;
+
+/*
+ * Replace the allocation holding the posting list with a tight copy when
+ * direct io padding makes up a significant part of the allocation.
+ */
+void
+trim(const IPostingListCache::Key& key, PostingListHandle& handle)
+{
+    if (!handle._allocMem || key.bit_offset < handle._bitOffsetMem) {
+        return;
+    }
+    uint64_t end_bit_offset = key.bit_offset + key.bit_length - handle._bitOffsetMem;
+    size_t vector_len = (end_bit_offset + 63) / 64 * 8;
+    size_t trimmed_size = vector_len + decode_prefetch_padding;
+    if (trimmed_size + trimmed_size / 8 >= handle._allocSize) {
+        return;
+    }
+    auto* copy = static_cast<char*>(malloc(trimmed_size));
+    if (copy == nullptr) {
+        return;
+    }
+    memcpy(copy, handle._mem, vector_len);
+    memset(copy + vector_len, 0, decode_prefetch_padding);
+    handle._mem = copy;
+    handle._allocMem = std::shared_ptr<void>(copy, free);
+    handle._allocSize = trimmed_size;
+}
+
+}
+
 class PostingListCache::BackingStore
 {
+    const PostingListCache& _owner;
 public:
-    BackingStore();
+    BackingStore(const PostingListCache& owner);
     ~BackingStore();
     bool read(const IPostingListCache::Key& key, PostingListHandle& value) const;
+    bool admit(const IPostingListCache::Key& key, const PostingListHandle& value) const;
 };
 
-PostingListCache::BackingStore::BackingStore() = default;
+PostingListCache::BackingStore::BackingStore(const PostingListCache& owner)
+    : _owner(owner)
+{
+}
+
 PostingListCache::BackingStore::~BackingStore() = default;
 
 bool
 PostingListCache::BackingStore::read(const IPostingListCache::Key& key, PostingListHandle& value) const
 {
-    // TODO: Store a smaller copy if posting list is small
     value = key.backing_store_file->read(key);
+    trim(key, value);
     return true;
 }
 
+bool
+PostingListCache::BackingStore::admit(const IPostingListCache::Key& key, const PostingListHandle& value) const
+{
+    return _owner.admit(key, value);
+}
+
 struct PostingListHandleSize {
     size_t operator() (const PostingListHandle & arg) const noexcept { return arg._allocSize; }
 };
@@ -57,17 +105,43 @@ PostingListCache::Cache::Cache(BackingStore& backing_store, size_t max_bytes)
 PostingListCache::Cache::~Cache() = default;
 
 PostingListCache::PostingListCache(size_t max_bytes)
+    : PostingListCache(max_bytes, false)
+{
+}
+
+PostingListCache::PostingListCache(size_t max_bytes, bool admission_filter)
     : IPostingListCache(),
-      _backing_store(std::make_unique<BackingStore>()),
-      _cache(std::make_unique<Cache>(*_backing_store, max_bytes))
+      _backing_store(std::make_unique<BackingStore>(*this)),
+      _cache(std::make_unique<Cache>(*_backing_store, max_bytes)),
+      _sketch()
 {
+    if (admission_filter) {
+        // Assume an average cached posting list size of 256 bytes when sizing the sketch
+        _sketch = std::make_unique<FrequencySketch>(max_bytes / 256);
+    }
 }
 
 PostingListCache::~PostingListCache() = default;
 
+bool
+PostingListCache::admit(const Key& key, const PostingListHandle& value) const
+{
+    if (!_sketch) {
+        return true;
+    }
+    size_t size = element_size() + value._allocSize;
+    if (_cache->sizeBytes() + size <= _cache->capacityBytes()) {
+        return true;
+    }
+    return _sketch->estimate(key.hash()) >= admission_threshold;
+}
+
 PostingListHandle
 PostingListCache::read(const Key& key) const
 {
+    if (_sketch) {
+        _sketch->add(key.hash());
+    }
     return _cache->read(key);
 }
 
@@ -6,9 +6,16 @@
 
 namespace search::diskindex {
 
+class FrequencySketch;
+
 /*
  * Class for caching posting lists read from disk.
- * It uses an LRU cache from vespalib.
+ * It uses an LRU cache from vespalib. Posting lists are kept in their
+ * compressed form and are decoded by the iterators on access.
+ *
+ * If the admission filter is enabled, a posting list read on cache miss
+ * is only inserted into a full cache if it has been accessed before
+ * (TinyLFU style admission), thus one-off terms don't evict hot terms.
  */
 class PostingListCache : public IPostingListCache {
 public:
@@ -17,8 +24,13 @@ private:
     class Cache;
     std::unique_ptr<const BackingStore> _backing_store;
     std::unique_ptr<Cache> _cache;
+    std::unique_ptr<FrequencySketch> _sketch;
+    bool admit(const Key& key, const search::index::PostingListHandle& value) const;
 public:
+    // Minimum estimated access frequency for a posting list to be admitted into a full cache
+    static constexpr uint32_t admission_threshold = 2;
     PostingListCache(size_t max_bytes);
+    PostingListCache(size_t max_bytes, bool admission_filter);
     ~PostingListCache() override;
     search::index::PostingListHandle read(const Key& key) const override;
     vespalib::CacheStats get_stats() const override;
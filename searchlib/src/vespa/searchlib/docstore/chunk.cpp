@@ -64,11 +64,12 @@ Chunk::getMaxPackSize(CompressionConfig compression) const {
 }
 
 void
-Chunk::pack(uint64_t lastSerial, vespalib::DataBuffer & compressed, CompressionConfig compression)
+Chunk::pack(uint64_t lastSerial, vespalib::DataBuffer & compressed, CompressionConfig compression,
+            const ZStdDictionary * dictionary)
 {
     _lastSerial = lastSerial;
     std::lock_guard guard(_lock);
-    _format->pack(_lastSerial, compressed, compression);
+    _format->pack(_lastSerial, compressed, compression, dictionary);
 }
 
 Chunk::Chunk(uint32_t id, const Config & config) :
@@ -80,10 +81,10 @@ Chunk::Chunk(uint32_t id, const Config & config) :
     _lids.reserve(4_Ki/sizeof(Entry));
 }
 
-Chunk::Chunk(uint32_t id, const void * buffer, size_t len) :
+Chunk::Chunk(uint32_t id, const void * buffer, size_t len, const ZStdDictionary * dictionary) :
     _id(id),
     _lastSerial(static_cast<uint64_t>(-1l)),
-    _format(ChunkFormat::deserialize(buffer, len))
+    _format(ChunkFormat::deserialize(buffer, len, dictionary))
 {
     vespalib::nbostream &os = getData();
     while (os.size() > sizeof(_lastSerial)) {
@@ -14,6 +14,7 @@ namespace vespalib {
     class DataBuffer;
 }
 namespace vespalib::alloc { class Alloc; }
+namespace vespalib::compression { class ZStdDictionary; }
 
 namespace search {
 
@@ -60,6 +61,7 @@ public:
     using UP = std::unique_ptr<Chunk>;
     using CompressionConfig = vespalib::compression::CompressionConfig;
     using ConstBufferRef = vespalib::ConstBufferRef;
+    using ZStdDictionary = vespalib::compression::ZStdDictionary;
     class Config {
     public:
         Config(size_t maxBytes) noexcept : _maxBytes(maxBytes) { }
@@ -83,7 +85,7 @@ public:
     };
     using LidList = std::vector<Entry>;
     Chunk(uint32_t id, const Config & config);
-    Chunk(uint32_t id, const void * buffer, size_t len);
+    Chunk(uint32_t id, const void * buffer, size_t len, const ZStdDictionary * dictionary = nullptr);
     ~Chunk();
     LidMeta append(uint32_t lid, ConstBufferRef data);
     ssize_t read(uint32_t lid, vespalib::DataBuffer & buffer) const;
@@ -94,7 +96,8 @@ public:
     const LidList & getLids() const { return _lids; }
     LidList getUniqueLids() const;
     size_t getMaxPackSize(CompressionConfig compression) const;
-    void pack(uint64_t lastSerial, vespalib::DataBuffer & buffer, CompressionConfig compression);
+    void pack(uint64_t lastSerial, vespalib::DataBuffer & buffer, CompressionConfig compression,
+              const ZStdDictionary * dictionary = nullptr);
     uint64_t getLastSerial() const { return _lastSerial; }
     uint32_t getId() const { return _id; }
     ConstBufferRef getLid(uint32_t lid) const;
@@ -1,7 +1,7 @@
 // Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
 
 #include "chunkformats.h"
-#include <vespa/vespalib/util/compressor.h>
+#include <vespa/vespalib/util/zstdcompressor.h>
 #include <vespa/vespalib/util/stringfmt.h>
 
 namespace search {
@@ -12,6 +12,7 @@ using vespalib::compression::compress;
 using vespalib::compression::decompress;
 using vespalib::compression::computeMaxCompressedsize;
 using vespalib::compression::CompressionConfig;
+using vespalib::compression::ZStdDictCompressor;
 
 ChunkException::ChunkException(const std::string & msg, std::string_view location) :
     Exception(make_string("Illegal chunk: %s", msg.c_str()), location)
@@ -19,7 +20,8 @@ ChunkException::ChunkException(const std::string & msg, std::string_view locatio
 }
 
 void
-ChunkFormat::pack(uint64_t lastSerial, vespalib::DataBuffer & compressed, CompressionConfig compression)
+ChunkFormat::pack(uint64_t lastSerial, vespalib::DataBuffer & compressed, CompressionConfig compression,
+                  const ZStdDictionary * dictionary)
 {
     vespalib::nbostream & os = _dataBuf;
     os << lastSerial;
@@ -33,7 +35,14 @@ ChunkFormat::pack(uint64_t lastSerial, vespalib::DataBuffer & compressed, Compre
     const size_t oldPos(compressed.getDataLen());
     compressed.writeInt8(compression.type);
     compressed.writeInt32(os.size());
-    CompressionConfig::Type type(compress(compression, vespalib::ConstBufferRef(os.data(), os.size()), compressed, false));
+    vespalib::ConstBufferRef uncompressed(os.data(), os.size());
+    CompressionConfig::Type type(CompressionConfig::NONE);
+    if ((dictionary != nullptr) && (compression.type == CompressionConfig::ZSTD)) {
+        ZStdDictCompressor zstd(*dictionary);
+        type = compress(zstd, compression, uncompressed, compressed, false);
+    } else {
+        type = compress(compression, uncompressed, compressed, false);
+    }
     if (compression.type != type) {
         compressed.getData()[oldPos] = type;
     }
@@ -67,7 +76,7 @@ ChunkFormat::verifyCompression(uint8_t type)
 }
 
 ChunkFormat::UP
-ChunkFormat::deserialize(const void * buffer, size_t len)
+ChunkFormat::deserialize(const void * buffer, size_t len, const ZStdDictionary * dictionary)
 {
     uint8_t version(0);
     vespalib::nbostream raw(buffer, len);
@@ -82,9 +91,9 @@ ChunkFormat::deserialize(const void * buffer, size_t len)
     raw >> crc32;
     raw.rp(currPos);
     if (version == ChunkFormatV1::VERSION) {
-        return std::make_unique<ChunkFormatV1>(raw, crc32);
+        return std::make_unique<ChunkFormatV1>(raw, crc32, dictionary);
     } else if (version == ChunkFormatV2::VERSION) {
-            return std::make_unique<ChunkFormatV2>(raw, crc32);
+        return std::make_unique<ChunkFormatV2>(raw, crc32, dictionary);
     } else {
         throw ChunkException(make_string("Unknown version %d", version), VESPA_STRLOC);
     }
@@ -109,7 +118,7 @@ ChunkFormat::verifyCrc(const vespalib::nbostream & is, uint32_t expectedCrc) con
 }
 
 void
-ChunkFormat::deserializeBody(vespalib::nbostream & is)
+ChunkFormat::deserializeBody(vespalib::nbostream & is, const ZStdDictionary * dictionary)
 {
     if (includeSerializedSize()) {
         uint32_t serializedSize(0);
@@ -128,7 +137,12 @@ ChunkFormat::deserializeBody(vespalib::nbostream & is)
     // This is a dirty trick to fool some odd sanity checking in DataBuffer::swap
     vespalib::DataBuffer uncompressed(const_cast<char *>(is.peek()), (size_t)0);
     vespalib::ConstBufferRef data(is.peek(), is.size() - sizeof(uint32_t));
-    decompress(CompressionConfig::Type(type), uncompressedLen, data, uncompressed, true);
+    if ((dictionary != nullptr) && (type == CompressionConfig::ZSTD)) {
+        ZStdDictCompressor zstd(*dictionary);
+        decompress(zstd, uncompressedLen, data, uncompressed, true);
+    } else {
+        decompress(CompressionConfig::Type(type), uncompressedLen, data, uncompressed, true);
+    }
     assert(uncompressed.getData() == uncompressed.getDead());
     if (uncompressed.getData() != data.c_str()) {
         const size_t sz(uncompressed.getDataLen());
@@ -4,6 +4,8 @@
 #include "logdatastore.h"
 #include <vespa/vespalib/util/size_literals.h>
 #include <vespa/vespalib/util/array.hpp>
+#include <vespa/vespalib/util/zstdcompressor.h>
+#include <vespa/vespalib/data/databuffer.h>
 #include <cassert>
 
 #include <vespa/log/log.h>
@@ -12,9 +14,31 @@ LOG_SETUP(".searchlib.docstore.compacter");
 namespace search::docstore {
 
 using vespalib::alloc::Alloc;
+using vespalib::compression::ZStdDictionary;
 
 namespace {
     constexpr size_t INITIAL_BACKING_BUFFER_SIZE = 64_Mi;
+    // zstd recommends roughly 100 times the dictionary size as training input.
+    constexpr size_t SAMPLES_PER_DICTIONARY_BYTE = 100;
+    constexpr size_t MAX_SAMPLE_BYTES = 32_Mi;
+}
+
+std::shared_ptr<const ZStdDictionary>
+trainDictionary(const FileChunk & source, size_t maxDictionarySize)
+{
+    vespalib::DataBuffer samples;
+    std::vector<size_t> sampleSizes;
+    source.sampleEntries(std::min(maxDictionarySize * SAMPLES_PER_DICTIONARY_BYTE, MAX_SAMPLE_BYTES), samples, sampleSizes);
+    std::shared_ptr<const ZStdDictionary> dictionary =
+            ZStdDictionary::train(vespalib::ConstBufferRef(samples.getData(), samples.getDataLen()), sampleSizes, maxDictionarySize);
+    if (dictionary) {
+        LOG(info, "Trained zstd dictionary of %zu bytes from %zu entries (%zu bytes) in file '%s'",
+            dictionary->content().size(), sampleSizes.size(), samples.getDataLen(), source.getName().c_str());
+    } else {
+        LOG(info, "Could not train zstd dictionary from %zu entries (%zu bytes) in file '%s'",
+            sampleSizes.size(), samples.getDataLen(), source.getName().c_str());
+    }
+    return dictionary;
 }
 
 void
@@ -23,6 +23,13 @@ private:
     LogDataStore & _ds;
 };
 
+/**
+ * Trains a zstd dictionary of at most maxDictionarySize bytes from entries sampled from source.
+ * Returns nullptr if there is too little data to train a dictionary.
+ */
+std::shared_ptr<const vespalib::compression::ZStdDictionary>
+trainDictionary(const FileChunk & source, size_t maxDictionarySize);
+
 class BucketIndexStore : public StoreByBucket::StoreIndex {
 public:
     BucketIndexStore(size_t maxSignificantBucketBits, uint32_t numPartitions) noexcept;
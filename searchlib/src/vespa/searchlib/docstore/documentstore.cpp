@@ -6,6 +6,7 @@
 #include "value.h"
 #include <vespa/document/fieldvalue/document.h>
 #include <vespa/vespalib/stllike/cache.hpp>
+#include <vespa/vespalib/stllike/hash_map.hpp>
 #include <vespa/vespalib/data/databuffer.h>
 #include <vespa/vespalib/util/compressor.h>
 #include <vespa/vespalib/util/size_literals.h>
@@ -43,6 +44,52 @@ DocumentVisitorAdapter::visit(uint32_t lid, vespalib::ConstBufferRef buf) {
     }
 }
 
+/*
+ * Hands documents read in batch from the backing store to the visitor, and
+ * populates the cache with them as a cache miss on a single read would have.
+ * The cache generation of each lid is captured before the batch is read, so
+ * that a document written or removed while the batch is read is not
+ * inserted into the cache with stale content.
+ */
+template <typename Cache>
+class PopulatingVisitorAdapter : public IBufferVisitor
+{
+public:
+    PopulatingVisitorAdapter(Cache & cache, const IDocumentStore::LidVector & lids, CompressionConfig compression,
+                             const DocumentTypeRepo & repo, IDocumentVisitor & visitor)
+        : _cache(cache),
+          _generations(lids.size()*2),
+          _compression(compression),
+          _repo(repo),
+          _visitor(visitor)
+    {
+        for (uint32_t lid : lids) {
+            _generations[lid] = _cache.getGeneration(lid);
+        }
+    }
+    void visit(uint32_t lid, vespalib::ConstBufferRef buf) override {
+        if (buf.size() > 0) {
+            vespalib::nbostream is(buf.c_str(), buf.size());
+            _visitor.visit(lid, std::make_unique<document::Document>(_repo, is));
+            auto found = _generations.find(lid);
+            if (found == _generations.end()) {
+                return;
+            }
+            vespalib::DataBuffer copy(buf.size());
+            copy.writeBytes(buf.c_str(), buf.size());
+            docstore::Value value;
+            value.set(std::move(copy), buf.size(), _compression);
+            _cache.populate(lid, std::move(value), found->second);
+        }
+    }
+private:
+    Cache                                  & _cache;
+    vespalib::hash_map<uint32_t, uint64_t>   _generations;
+    CompressionConfig                        _compression;
+    const DocumentTypeRepo                 & _repo;
+    IDocumentVisitor                       & _visitor;
+};
+
 }
 
 using vespalib::nbostream;
@@ -169,6 +216,51 @@ DocumentStore::visit(const LidVector & lids, const DocumentTypeRepo &repo, IDocu
     }
 }
 
+void
+DocumentStore::readMany(const LidVector & lids, const DocumentTypeRepo &repo, IDocumentVisitor & visitor) const
+{
+    if ( ! useCache()) {
+        _uncached_lookups.fetch_add(lids.size());
+        _store->visit(lids, repo, visitor);
+        return;
+    }
+    LidVector misses;
+    for (DocumentIdT lid : lids) {
+        if (_cache->hasKey(lid)) {
+            DocumentUP doc = read(lid, repo);
+            if (doc) {
+                visitor.visit(lid, std::move(doc));
+            }
+        } else {
+            misses.push_back(lid);
+        }
+    }
+    if (misses.empty()) {
+        return;
+    }
+    _uncached_lookups.fetch_add(misses.size());
+    PopulatingVisitorAdapter<docstore::Cache> adapter(*_cache, misses, _store->getCompression(), repo, visitor);
+    _backingStore.read(misses, adapter);
+}
+
+void
+DocumentStore::prefetch(const LidVector & lids) const
+{
+    if ( ! useCache()) {
+        _backingStore.prefetch(lids);
+        return;
+    }
+    LidVector misses;
+    for (DocumentIdT lid : lids) {
+        if ( ! _cache->hasKey(lid)) {
+            misses.push_back(lid);
+        }
+    }
+    if ( ! misses.empty()) {
+        _backingStore.prefetch(misses);
+    }
+}
+
 std::unique_ptr<document::Document>
 DocumentStore::read(DocumentIdT lid, const DocumentTypeRepo &repo) const
 {
@@ -221,6 +313,8 @@ DocumentStore::write(uint64_t syncToken, DocumentIdT lid, const vespalib::nbostr
                     _cache->write(lid, std::move(value));
                 } else {
                     _backingStore.write(syncToken, lid, stream.peek(), stream.size());
+                    // Makes sure a concurrent batched read does not populate the cache with the old document.
+                    _cache->invalidate(lid);
                 }
                 break;
         }
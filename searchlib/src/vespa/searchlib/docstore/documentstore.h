@@ -59,6 +59,8 @@ public:
 
     DocumentUP read(DocumentIdT lid, const document::DocumentTypeRepo &repo) const override;
     void visit(const LidVector & lids, const document::DocumentTypeRepo &repo, IDocumentVisitor & visitor) const override;
+    void readMany(const LidVector & lids, const document::DocumentTypeRepo &repo, IDocumentVisitor & visitor) const override;
+    void prefetch(const LidVector & lids) const override;
     void write(uint64_t synkToken, DocumentIdT lid, const document::Document& doc) override;
     void write(uint64_t synkToken, DocumentIdT lid, const vespalib::nbostream & os) override;
     void remove(uint64_t syncToken, DocumentIdT lid) override;
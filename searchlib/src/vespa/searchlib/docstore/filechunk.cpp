@@ -8,10 +8,13 @@
 #include <vespa/vespalib/util/lambdatask.h>
 #include <vespa/vespalib/data/fileheader.h>
 #include <vespa/vespalib/data/databuffer.h>
+#include <vespa/vespalib/encoding/base64.h>
 #include <vespa/vespalib/stllike/asciistream.h>
 #include <vespa/vespalib/objects/nbostream.h>
 #include <vespa/vespalib/util/executor.h>
 #include <vespa/vespalib/util/arrayqueue.hpp>
+#include <vespa/vespalib/util/size_literals.h>
+#include <vespa/vespalib/util/zstdcompressor.h>
 #include <vespa/fastos/file.h>
 #include <exception>
 #include <filesystem>
@@ -23,6 +26,7 @@ LOG_SETUP(".search.filechunk");
 using vespalib::CpuUsage;
 using vespalib::GenericHeader;
 using vespalib::getErrorString;
+using vespalib::compression::ZStdDictionary;
 
 namespace search {
 
@@ -31,6 +35,11 @@ namespace {
 constexpr size_t ALIGNMENT=0x1000;
 constexpr size_t ENTRY_BIAS_SIZE=8;
 const std::string DOC_ID_LIMIT_KEY("docIdLimit");
+const std::string DICTIONARY_KEY("zstdDictionary");
+constexpr size_t MAX_SAMPLED_CHUNKS = 256;
+// Upper bound on compressed chunk data fetched in a single batched read.
+constexpr size_t MAX_BATCHED_READ_BYTES = 4_Mi;
+constexpr size_t MAX_BATCHED_READ_CHUNKS = 64;
 
 }
 
@@ -84,7 +93,8 @@ FileChunk::FileChunk(FileId fileId, NameId nameId, const std::string & baseName,
       _idxHeaderLen(0u),
       _numLids(0),
       _docIdLimit(std::numeric_limits<uint32_t>::max()),
-      _modificationTime()
+      _modificationTime(),
+      _dictionary()
 {
     FastOS_File dataFile(_dataFileName.c_str());
     if (dataFile.OpenReadOnly()) {
@@ -234,6 +244,9 @@ FileChunk::enableRead()
             LOG(debug, "enableRead(): MMapRandReadDynamic: file='%s'", _dataFileName.c_str());
             _file = std::make_unique<MMapRandReadDynamic>(_dataFileName, mmapFlags, fadviseOptions);
         }
+    } else if (_tune._randRead.getWantUring() && UringRandRead::isSupported()) {
+        LOG(debug, "enableRead(): UringRandRead: file='%s'", _dataFileName.c_str());
+        _file = std::make_unique<UringRandRead>(_dataFileName);
     } else {
         LOG(debug, "enableRead(): NormalRandRead: file='%s'", _dataFileName.c_str());
         _file = std::make_unique<NormalRandRead>(_dataFileName);
@@ -242,6 +255,18 @@ FileChunk::enableRead()
     if (_dataHeaderLen == 0u) {
         throw std::runtime_error(make_string("bad file header: %s", _dataFileName.c_str()));
     }
+    if ( ! _dictionary) {
+        vespalib::DataBuffer h(_dataHeaderLen, ALIGNMENT);
+        FileRandRead::FSP keepAlive = _file->read(0, h, _dataHeaderLen);
+        GenericHeader::BufferReader rd(h);
+        GenericHeader header;
+        header.read(rd);
+        try {
+            _dictionary = readDictionary(header);
+        } catch (const vespalib::IllegalArgumentException & e) {
+            throw std::runtime_error(make_string("bad dictionary in file header: %s: %s", _dataFileName.c_str(), e.what()));
+        }
+    }
 }
 
 size_t FileChunk::adjustSize(size_t sz) {
@@ -339,7 +364,7 @@ FileChunk::appendTo(vespalib::Executor & executor, const IGetLid & db, IWriteDat
             try {
                 vespalib::DataBuffer whole(0ul, ALIGNMENT);
                 FileRandRead::FSP keepAlive(_file->read(cInfo.getOffset(), whole, cInfo.getSize()));
-                promise.set_value(std::make_unique<Chunk>(chunkId, whole.getData(), whole.getDataLen()));
+                promise.set_value(std::make_unique<Chunk>(chunkId, whole.getData(), whole.getDataLen(), _dictionary.get()));
             } catch (std::exception& e) {
                 promise.set_exception(std::make_exception_ptr(
                     std::runtime_error(std::string("File '") + _dataFileName +
@@ -369,29 +394,52 @@ void
 FileChunk::read(LidInfoWithLidV::const_iterator begin, size_t count, IBufferVisitor & visitor) const
 {
     if (count == 0) { return; }
+    std::vector<ChunkLids> chunks;
     uint32_t prevChunk = begin->getChunkId();
     uint32_t start(0);
     for (size_t i(0); i < count; i++) {
         const LidInfoWithLid & li = *(begin + i);
         if (li.getChunkId() != prevChunk) {
-            ChunkInfo ci = _chunkInfo[prevChunk];
-            read(begin + start, i - start, ci, visitor);
+            chunks.push_back({begin + start, i - start, _chunkInfo[prevChunk]});
             prevChunk = li.getChunkId();
             start = i;
         }
     }
-    ChunkInfo ci = _chunkInfo[prevChunk];
-    read(begin + start, count - start, ci, visitor);
+    chunks.push_back({begin + start, count - start, _chunkInfo[prevChunk]});
+    readChunks(chunks, visitor);
 }
 
 void
-FileChunk::read(LidInfoWithLidV::const_iterator begin, size_t count, ChunkInfo ci, IBufferVisitor & visitor) const
+FileChunk::readChunks(std::span<const ChunkLids> chunks, IBufferVisitor & visitor) const
 {
-    vespalib::DataBuffer whole(0ul, ALIGNMENT);
-    FileRandRead::FSP keepAlive = _file->read(ci.getOffset(), whole, ci.getSize());
-    Chunk chunk(begin->getChunkId(), whole.getData(), whole.getDataLen());
-    for (size_t i(0); i < count; i++) {
-        const LidInfoWithLid & li = *(begin + i);
+    if ( ! _file->prefersBatchedReads()) {
+        for (const ChunkLids & chunkLids : chunks) {
+            read(chunkLids, visitor);
+        }
+        return;
+    }
+    size_t start(0);
+    size_t batchBytes(0);
+    for (size_t i(0); i < chunks.size(); i++) {
+        batchBytes += chunks[i].chunkInfo.getSize();
+        size_t batchSize = i + 1 - start;
+        if ((batchBytes >= MAX_BATCHED_READ_BYTES) || (batchSize >= MAX_BATCHED_READ_CHUNKS)) {
+            read(chunks.subspan(start, batchSize), visitor);
+            start = i + 1;
+            batchBytes = 0;
+        }
+    }
+    if (start < chunks.size()) {
+        read(chunks.subspan(start), visitor);
+    }
+}
+
+void
+FileChunk::visitChunk(const ChunkLids & chunkLids, const vespalib::DataBuffer & whole, IBufferVisitor & visitor) const
+{
+    Chunk chunk(chunkLids.begin->getChunkId(), whole.getData(), whole.getDataLen(), _dictionary.get());
+    for (size_t j(0); j < chunkLids.count; j++) {
+        const LidInfoWithLid & li = *(chunkLids.begin + j);
         vespalib::ConstBufferRef buf = chunk.getLid(li.getLid());
         if (buf.size() != 0) {
             visitor.visit(li.getLid(), buf);
@@ -399,6 +447,48 @@ FileChunk::read(LidInfoWithLidV::const_iterator begin, size_t count, ChunkInfo c
     }
 }
 
+void
+FileChunk::read(const ChunkLids & chunkLids, IBufferVisitor & visitor) const
+{
+    vespalib::DataBuffer whole(0ul, ALIGNMENT);
+    FileRandRead::FSP keepAlive = _file->read(chunkLids.chunkInfo.getOffset(), whole, chunkLids.chunkInfo.getSize());
+    visitChunk(chunkLids, whole, visitor);
+}
+
+void
+FileChunk::read(std::span<const ChunkLids> chunks, IBufferVisitor & visitor) const
+{
+    std::vector<vespalib::DataBuffer> wholes;
+    std::vector<FileRandRead::ReadRequest> requests;
+    wholes.reserve(chunks.size());
+    requests.reserve(chunks.size());
+    for (const ChunkLids & chunkLids : chunks) {
+        wholes.emplace_back(0ul, ALIGNMENT);
+        requests.push_back({chunkLids.chunkInfo.getOffset(), chunkLids.chunkInfo.getSize(), &wholes.back()});
+    }
+    std::vector<FileRandRead::FSP> keepAlive = _file->readMany(requests);
+    for (size_t i(0); i < chunks.size(); i++) {
+        visitChunk(chunks[i], wholes[i], visitor);
+    }
+}
+
+void
+FileChunk::prefetch(LidInfoWithLidV::const_iterator begin, size_t count) const
+{
+    for (size_t i(0); i < count; i++) {
+        uint32_t chunkId = (begin + i)->getChunkId();
+        if ((i == 0) || (chunkId != (begin + i - 1)->getChunkId())) {
+            prefetchChunk(_chunkInfo[chunkId]);
+        }
+    }
+}
+
+void
+FileChunk::prefetchChunk(const ChunkInfo & chunkInfo) const
+{
+    _file->prefetch(chunkInfo.getOffset(), chunkInfo.getSize());
+}
+
 ssize_t
 FileChunk::read(uint32_t lid, SubChunkId chunkId,
                 vespalib::DataBuffer & buffer) const
@@ -414,7 +504,7 @@ FileChunk::read(uint32_t lid, SubChunkId chunkId, const ChunkInfo & chunkInfo,
 {
     vespalib::DataBuffer whole(0ul, ALIGNMENT);
     FileRandRead::FSP keepAlive(_file->read(chunkInfo.getOffset(), whole, chunkInfo.getSize()));
-    Chunk chunk(chunkId, whole.getData(), whole.getDataLen());
+    Chunk chunk(chunkId, whole.getData(), whole.getDataLen(), _dictionary.get());
     return chunk.read(lid, buffer);
 }
 
@@ -426,7 +516,7 @@ FileChunk::readDataHeader(FileRandRead &datFile)
     uint32_t hl = GenericHeader::getMinSize();
     if (fileSize >= hl) {
         vespalib::DataBuffer h(hl, ALIGNMENT);
-        datFile.read(0, h, hl);
+        FileRandRead::FSP keepAlive = datFile.read(0, h, hl);
         GenericHeader::BufferReader rd(h);
         uint32_t headerLen = GenericHeader::readSize(rd);
         if (headerLen <= fileSize) {
@@ -476,6 +566,51 @@ FileChunk::writeDocIdLimit(vespalib::GenericHeader &header, uint32_t docIdLimit)
     header.putTag(vespalib::GenericHeader::Tag(DOC_ID_LIMIT_KEY, docIdLimit));
 }
 
+std::shared_ptr<const ZStdDictionary>
+FileChunk::readDictionary(const vespalib::GenericHeader &header)
+{
+    if (header.hasTag(DICTIONARY_KEY)) {
+        std::string content = vespalib::Base64::decode(header.getTag(DICTIONARY_KEY).asString());
+        return std::make_shared<ZStdDictionary>(vespalib::ConstBufferRef(content.data(), content.size()));
+    }
+    return {};
+}
+
+void
+FileChunk::writeDictionary(vespalib::GenericHeader &header, const ZStdDictionary &dictionary)
+{
+    vespalib::ConstBufferRef content = dictionary.content();
+    header.putTag(vespalib::GenericHeader::Tag(DICTIONARY_KEY, vespalib::Base64::encode(content.c_str(), content.size())));
+}
+
+void
+FileChunk::sampleEntries(size_t maxBytes, vespalib::DataBuffer & samples, std::vector<size_t> & sampleSizes) const
+{
+    const size_t numChunks = getNumChunks();
+    if ((numChunks == 0) || (maxBytes == 0)) {
+        return;
+    }
+    const size_t numSampledChunks = std::min(numChunks, MAX_SAMPLED_CHUNKS);
+    const size_t maxBytesPerChunk = std::max(1ul, maxBytes / numSampledChunks);
+    for (size_t i(0); (i < numSampledChunks) && (samples.getDataLen() < maxBytes); i++) {
+        size_t chunkId = (i * numChunks) / numSampledChunks;
+        const ChunkInfo & cInfo(_chunkInfo[chunkId]);
+        vespalib::DataBuffer whole(0ul, ALIGNMENT);
+        FileRandRead::FSP keepAlive(_file->read(cInfo.getOffset(), whole, cInfo.getSize()));
+        const Chunk chunk(chunkId, whole.getData(), whole.getDataLen(), _dictionary.get());
+        const char * data = chunk.getData().data();
+        size_t taken(0);
+        for (const Chunk::Entry & entry : chunk.getLids()) {
+            if ((taken + entry.netSize() > maxBytesPerChunk) || (samples.getDataLen() + entry.netSize() > maxBytes)) {
+                break;
+            }
+            samples.writeBytes(data + entry.getNetOffset(), entry.netSize());
+            sampleSizes.push_back(entry.netSize());
+            taken += entry.netSize();
+        }
+    }
+}
+
 void
 FileChunk::verify(bool reportOnly) const
 {
@@ -490,7 +625,7 @@ FileChunk::verify(bool reportOnly) const
         vespalib::DataBuffer whole(0ul, ALIGNMENT);
         FileRandRead::FSP keepAlive(_file->read(ci.getOffset(), whole, ci.getSize()));
         try {
-            Chunk chunk(chunkId++, whole.getData(), whole.getDataLen());
+            Chunk chunk(chunkId++, whole.getData(), whole.getDataLen(), _dictionary.get());
             assert(chunk.getLastSerial() >= lastSerial);
             lastSerial = chunk.getLastSerial();
             if (errorInPrev) {
@@ -20,6 +20,7 @@ namespace vespalib {
     class GenericHeader;
     class Executor;
 }
+namespace vespalib::compression { class ZStdDictionary; }
 
 namespace search {
 
@@ -112,6 +113,11 @@ public:
     virtual void updateLidMap(const unique_lock &guard, ISetLid &lidMap, uint64_t serialNum, uint32_t docIdLimit);
     virtual ssize_t read(uint32_t lid, SubChunkId chunk, vespalib::DataBuffer & buffer) const;
     virtual void read(LidInfoWithLidV::const_iterator begin, size_t count, IBufferVisitor & visitor) const;
+    /**
+     * Hints the file that the chunks holding the given lids will be read soon.
+     * The lids must be sorted on chunk id, as for read.
+     */
+    virtual void prefetch(LidInfoWithLidV::const_iterator begin, size_t count) const;
     void remove(uint32_t lid, uint32_t size);
     virtual size_t getDiskFootprint() const { return _diskFootprint.load(std::memory_order_relaxed); }
     virtual size_t getMemoryFootprint() const;
@@ -183,6 +189,17 @@ public:
      */
     void verify(bool reportOnly) const;
 
+    /**
+     * Collects up to maxBytes of entry data from chunks spread evenly over the file. The entries
+     * are stored back to back in samples, with their sizes in sampleSizes. Used for training
+     * a compression dictionary.
+     */
+    void sampleEntries(size_t maxBytes, vespalib::DataBuffer & samples, std::vector<size_t> & sampleSizes) const;
+    /**
+     * The dictionary the chunks of this file are compressed with, if any.
+     */
+    const std::shared_ptr<const vespalib::compression::ZStdDictionary> & getDictionary() const { return _dictionary; }
+
     uint32_t      getNumChunks() const;
     size_t       getNumBuckets() const { return _sumNumBuckets; }
     size_t getNumUniqueBuckets() const { return _numUniqueBuckets; }
@@ -243,9 +260,31 @@ protected:
 
     void setNumUniqueBuckets(size_t numUniqueBuckets) { _numUniqueBuckets = numUniqueBuckets; }
     ssize_t read(uint32_t lid, SubChunkId chunkId, const ChunkInfo & chunkInfo, vespalib::DataBuffer & buffer) const;
-    void read(LidInfoWithLidV::const_iterator begin, size_t count, ChunkInfo ci, IBufferVisitor & visitor) const;
+    /**
+     * The lids to visit in a single chunk on file.
+     */
+    struct ChunkLids {
+        LidInfoWithLidV::const_iterator begin;
+        size_t                          count;
+        ChunkInfo                       chunkInfo;
+    };
+    void read(const ChunkLids & chunkLids, IBufferVisitor & visitor) const;
+    /**
+     * Reads and visits the given chunks. They are fetched from file in batches of bounded
+     * size when the file reader prefers batched reads, and one by one otherwise.
+     */
+    void readChunks(std::span<const ChunkLids> chunks, IBufferVisitor & visitor) const;
+    /**
+     * Fetches all the given chunks in one batch from file before visiting them.
+     * Only used when the file reader prefers batched reads, the caller bounds the batch size.
+     */
+    void read(std::span<const ChunkLids> chunks, IBufferVisitor & visitor) const;
+    void visitChunk(const ChunkLids & chunkLids, const vespalib::DataBuffer & whole, IBufferVisitor & visitor) const;
+    void prefetchChunk(const ChunkInfo & chunkInfo) const;
     static uint32_t readDocIdLimit(vespalib::GenericHeader &header);
     static void writeDocIdLimit(vespalib::GenericHeader &header, uint32_t docIdLimit);
+    static std::shared_ptr<const vespalib::compression::ZStdDictionary> readDictionary(const vespalib::GenericHeader &header);
+    static void writeDictionary(vespalib::GenericHeader &header, const vespalib::compression::ZStdDictionary &dictionary);
 
     using ChunkInfoVector = std::vector<ChunkInfo, vespalib::allocator_large<ChunkInfo>>;
     const IBucketizer    * _bucketizer;
@@ -260,6 +299,7 @@ protected:
     uint32_t               _numLids;
     uint32_t               _docIdLimit; // Limit when the file was created. Stored in idx file header.
     vespalib::system_time  _modificationTime;
+    std::shared_ptr<const vespalib::compression::ZStdDictionary> _dictionary;
 };
 
 } // namespace search
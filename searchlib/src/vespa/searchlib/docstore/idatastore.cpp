@@ -14,4 +14,9 @@ IDataStore::~IDataStore()
 {
 }
 
+void
+IDataStore::prefetch(const LidVector &) const
+{
+}
+
 } // namespace search
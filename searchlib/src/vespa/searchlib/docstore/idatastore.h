@@ -58,6 +58,11 @@ public:
      **/
     virtual ssize_t read(uint32_t lid, vespalib::DataBuffer & buffer) const = 0;
     virtual void read(const LidVector & lids, IBufferVisitor & visitor) const = 0;
+    /**
+     * Hint that the given lids will be read soon, letting the store start
+     * fetching them in the background. The default implementation does nothing.
+     **/
+    virtual void prefetch(const LidVector & lids) const;
 
     /**
      * Write data to the data store.
@@ -11,4 +11,16 @@ void IDocumentStore::visit(const LidVector & lids, const document::DocumentTypeR
     }
 }
 
+void IDocumentStore::readMany(const LidVector & lids, const document::DocumentTypeRepo &repo, IDocumentVisitor & visitor) const {
+    for (uint32_t lid : lids) {
+        DocumentUP doc = read(lid, repo);
+        if (doc) {
+            visitor.visit(lid, std::move(doc));
+        }
+    }
+}
+
+void IDocumentStore::prefetch(const LidVector &) const {
+}
+
 } // namespace search
@@ -76,6 +76,18 @@ public:
      **/
     virtual DocumentUP read(DocumentIdT lid, const document::DocumentTypeRepo &repo) const = 0;
     virtual void visit(const LidVector & lidVector, const document::DocumentTypeRepo &repo, IDocumentVisitor & visitor) const;
+    /**
+     * Read many documents in one go, letting the store fetch and decompress
+     * each underlying chunk only once. Lids without a document are not visited,
+     * and the order of visiting is unspecified.
+     **/
+    virtual void readMany(const LidVector & lids, const document::DocumentTypeRepo &repo, IDocumentVisitor & visitor) const;
+    /**
+     * Hint that the documents for the given lids will be read soon. This only
+     * starts fetching them in the background and does not wait for it.
+     * The default implementation does nothing.
+     **/
+    virtual void prefetch(const LidVector & lids) const;
 
     /**
      * Serialize and store a document.
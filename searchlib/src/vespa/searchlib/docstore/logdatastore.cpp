@@ -48,7 +48,8 @@ LogDataStore::Config::Config()
       _minFileSizeFactor(0.2),
       _maxNumLids(DEFAULT_MAX_LIDS_PER_FILE),
       _compactCompression(CompressionConfig::LZ4),
-      _fileConfig()
+      _fileConfig(),
+      _compactDictionarySize(0)
 { }
 
 bool
@@ -57,7 +58,8 @@ LogDataStore::Config::operator == (const Config & rhs) const {
             (_maxFileSize == rhs._maxFileSize) &&
             (_minFileSizeFactor == rhs._minFileSizeFactor) &&
             (_compactCompression == rhs._compactCompression) &&
-            (_fileConfig == rhs._fileConfig);
+            (_fileConfig == rhs._fileConfig) &&
+            (_compactDictionarySize == rhs._compactDictionarySize);
 }
 
 class LogDataStore::FileChunkHolder
@@ -173,6 +175,29 @@ LogDataStore::read(const LidVector & lids, IBufferVisitor & visitor) const
     fc.read(orderedLids.begin() + start, orderedLids.size() - start, visitor);
 }
 
+void
+LogDataStore::prefetch(const LidVector & lids) const
+{
+    LidInfoWithLidV orderedLids;
+    GenerationHandler::Guard guard(_genHandler.takeGuard());
+    for (uint32_t lid : lids) {
+        if (lid < getDocIdLimit()) {
+            LidInfo li = vespalib::atomic::load_ref_acquire(_lidInfo.acquire_elem_ref(lid));
+            if (!li.empty() && li.valid()) {
+                orderedLids.emplace_back(li, lid);
+            }
+        }
+    }
+    std::sort(orderedLids.begin(), orderedLids.end());
+    size_t start = 0;
+    for (size_t curr(1); curr <= orderedLids.size(); curr++) {
+        if ((curr == orderedLids.size()) || (orderedLids[curr].getFileId() != orderedLids[start].getFileId())) {
+            _fileChunks[orderedLids[start].getFileId()]->prefetch(orderedLids.begin() + start, curr - start);
+            start = curr;
+        }
+    }
+}
+
 ssize_t
 LogDataStore::read(uint32_t lid, vespalib::DataBuffer& buffer) const
 {
@@ -471,9 +496,16 @@ void LogDataStore::compactFile(FileId fileId)
             compacted_size = (disk_footprint <= disk_bloat) ? 0u : (disk_footprint - disk_bloat);
         }
         if ( ! shouldCompactToActiveFile(compacted_size)) {
+            std::shared_ptr<const vespalib::compression::ZStdDictionary> dictionary;
+            if ((_config.getCompactDictionarySize() > 0) &&
+                (_config.getFileConfig().getCompression().type == CompressionConfig::ZSTD))
+            {
+                dictionary = docstore::trainDictionary(*fc, _config.getCompactDictionarySize());
+            }
             MonitorGuard guard(_updateLock);
             destinationFileId = allocateFileId(guard);
-            setNewFileChunk(guard, createWritableFile(destinationFileId, fc->getLastPersistedSerialNum(), fc->getNameId().next()));
+            setNewFileChunk(guard, createWritableFile(destinationFileId, fc->getLastPersistedSerialNum(),
+                                                      fc->getNameId().next(), std::move(dictionary)));
         }
         size_t numSignificantBucketBits = computeNumberOfSignificantBucketIdBits(*_bucketizer, fc->getFileId());
         compacter = std::make_unique<BucketCompacter>(numSignificantBucketBits, _config.compactCompression(), *this,
@@ -653,7 +685,8 @@ LogDataStore::createReadOnlyFile(FileId fileId, NameId nameId) {
 }
 
 FileChunk::UP
-LogDataStore::createWritableFile(FileId fileId, SerialNum serialNum, NameId nameId)
+LogDataStore::createWritableFile(FileId fileId, SerialNum serialNum, NameId nameId,
+                                 std::shared_ptr<const vespalib::compression::ZStdDictionary> dictionary)
 {
     for (const auto & fc : _fileChunks) {
         if (fc && (fc->getNameId() == nameId)) {
@@ -665,7 +698,7 @@ LogDataStore::createWritableFile(FileId fileId, SerialNum serialNum, NameId name
     uint32_t docIdLimit = (getDocIdLimit() != 0) ? getDocIdLimit() : std::numeric_limits<uint32_t>::max();
     auto file = std::make_unique< WriteableFileChunk>(_executor, fileId, nameId, getBaseDir(), serialNum,docIdLimit,
                                                       _config.getFileConfig(), _tune, _fileHeaderContext,
-                                                      _bucketizer.get());
+                                                      _bucketizer.get(), std::move(dictionary));
     file->enableRead();
     return file;
 }
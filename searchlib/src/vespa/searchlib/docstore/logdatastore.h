@@ -51,6 +51,7 @@ public:
 
         Config & compactCompression(CompressionConfig v) { _compactCompression = v; return *this; }
         Config & setFileConfig(WriteableFileChunk::Config v) { _fileConfig = v; return *this; }
+        Config & setCompactDictionarySize(size_t v) { _compactDictionarySize = v; return *this; }
 
         size_t getMaxFileSize() const { return _maxFileSize; }
         double getMaxBucketSpread() const noexcept { return _maxBucketSpread.load_relaxed(); }
@@ -60,6 +61,10 @@ public:
         CompressionConfig compactCompression() const { return _compactCompression; }
 
         const WriteableFileChunk::Config & getFileConfig() const { return _fileConfig; }
+        /**
+         * Max size of the zstd dictionary trained for each file written by compaction. 0 disables training.
+         */
+        size_t getCompactDictionarySize() const { return _compactDictionarySize; }
 
         bool operator == (const Config &) const;
     private:
@@ -69,6 +74,7 @@ public:
         uint32_t                    _maxNumLids;
         CompressionConfig           _compactCompression;
         WriteableFileChunk::Config  _fileConfig;
+        size_t                      _compactDictionarySize;
     };
 public:
     using ConstBufferRef = vespalib::ConstBufferRef;
@@ -97,6 +103,7 @@ public:
     // Implements IDataStore API
     ssize_t read(uint32_t lid, vespalib::DataBuffer & buffer) const override;
     void read(const LidVector & lids, IBufferVisitor & visitor) const override;
+    void prefetch(const LidVector & lids) const override;
     void write(uint64_t serialNum, uint32_t lid, const void * buffer, size_t len) override;
     void remove(uint64_t serialNum, uint32_t lid) override;
     void flush(uint64_t syncToken) override;
@@ -214,7 +221,8 @@ private:
 
     FileChunk::UP createReadOnlyFile(FileId fileId, NameId nameId);
     FileChunk::UP createWritableFile(FileId fileId, SerialNum serialNum);
-    FileChunk::UP createWritableFile(FileId fileId, SerialNum serialNum, NameId nameId);
+    FileChunk::UP createWritableFile(FileId fileId, SerialNum serialNum, NameId nameId,
+                                     std::shared_ptr<const vespalib::compression::ZStdDictionary> dictionary = {});
     std::string createFileName(NameId id) const;
     std::string createDatFileName(NameId id) const;
     std::string createIdxFileName(NameId id) const;
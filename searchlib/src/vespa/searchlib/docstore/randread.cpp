@@ -0,0 +1,26 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "randread.h"
+
+namespace search {
+
+std::vector<FileRandRead::FSP>
+FileRandRead::readMany(std::span<const ReadRequest> requests)
+{
+    std::vector<FSP> keepAlive;
+    keepAlive.reserve(requests.size());
+    for (const ReadRequest & request : requests) {
+        FSP fsp = read(request.offset, *request.buffer, request.sz);
+        if (fsp) {
+            keepAlive.push_back(std::move(fsp));
+        }
+    }
+    return keepAlive;
+}
+
+void
+FileRandRead::prefetch(size_t, size_t)
+{
+}
+
+}
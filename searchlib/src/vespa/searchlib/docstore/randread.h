@@ -5,6 +5,8 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <span>
+#include <vector>
 
 class FastOS_FileInterface;
 
@@ -16,8 +18,34 @@ class FileRandRead
 {
 public:
     using FSP = std::shared_ptr<FastOS_FileInterface>;
+    /**
+     * A single range to be read as part of a batch. When done the buffer
+     * contains the same as after read(offset, *buffer, sz).
+     */
+    struct ReadRequest {
+        size_t                 offset;
+        size_t                 sz;
+        vespalib::DataBuffer * buffer;
+    };
     virtual ~FileRandRead() = default;
     virtual FSP read(size_t offset, vespalib::DataBuffer & buffer, size_t sz) = 0;
+    /**
+     * Read a batch of ranges. The default implementation reads them one by one,
+     * implementations able to keep several reads in flight should override it.
+     * The returned handles must be kept alive as long as the buffers are used.
+     */
+    virtual std::vector<FSP> readMany(std::span<const ReadRequest> requests);
+    /**
+     * Returns true if readMany is cheaper than reading the ranges one by one,
+     * so that callers should collect several ranges before reading them.
+     */
+    virtual bool prefersBatchedReads() const { return false; }
+    /**
+     * Hint that the given range will be read soon. Implementations reading
+     * through the page cache start fetching it in the background, the
+     * default implementation does nothing.
+     */
+    virtual void prefetch(size_t offset, size_t sz);
     virtual int64_t getSize() const = 0;
 };
 
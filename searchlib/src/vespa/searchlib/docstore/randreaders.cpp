@@ -3,13 +3,98 @@
 #include "randreaders.h"
 #include "summaryexceptions.h"
 #include <vespa/vespalib/data/databuffer.h>
+#include <vespa/vespalib/io/fileutil.h>
+#include <vespa/vespalib/util/exceptions.h>
 #include <vespa/fastos/file.h>
+#include <vespa/config.h>
+#include <cstring>
+#include <exception>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#ifdef VESPA_HAS_IO_URING
+#include <liburing.h>
+#endif
 
 #include <vespa/log/log.h>
 LOG_SETUP(".search.docstore.randreaders");
 
+using vespalib::IoException;
+using vespalib::make_string;
+
 namespace search {
 
+namespace {
+
+#ifdef VESPA_HAS_IO_URING
+
+constexpr unsigned URING_QUEUE_DEPTH = 64;
+
+/*
+ * A ring per reading thread, shared by all files. It is only touched by
+ * its owning thread, so there is no locking.
+ */
+struct ThreadRing {
+    io_uring ring;
+    bool     valid;
+    ThreadRing() noexcept
+        : ring(),
+          valid(io_uring_queue_init(URING_QUEUE_DEPTH, &ring, 0) == 0)
+    { }
+    ~ThreadRing() {
+        if (valid) {
+            io_uring_queue_exit(&ring);
+        }
+    }
+    /*
+     * Drops any prepared but unsubmitted reads by creating a new ring. Must
+     * only be called when no submitted read is in flight.
+     */
+    void reset() {
+        if (valid) {
+            io_uring_queue_exit(&ring);
+        }
+        valid = (io_uring_queue_init(URING_QUEUE_DEPTH, &ring, 0) == 0);
+    }
+};
+
+ThreadRing &
+threadRing() {
+    thread_local ThreadRing ring;
+    return ring;
+}
+
+bool
+probeUring() {
+    io_uring_probe *probe = io_uring_get_probe();
+    bool supported = (probe != nullptr) && io_uring_opcode_supported(probe, IORING_OP_READ);
+    free(probe);
+    return supported;
+}
+
+#endif
+
+/*
+ * Asks the kernel to start paging in the mapped range, if all of it is mapped.
+ */
+void
+adviseWillNeed(const FastOS_FileInterface & file, size_t offset, size_t sz)
+{
+    if (sz == 0) {
+        return;
+    }
+    const char * data = static_cast<const char *>(file.MemoryMapPtr(offset));
+    if ((data == nullptr) || (file.MemoryMapPtr(offset + sz - 1) == nullptr)) {
+        return;
+    }
+    const size_t pageSize = getpagesize();
+    const char * start = data - (reinterpret_cast<uintptr_t>(data) % pageSize);
+    posix_madvise(const_cast<char *>(start), (data + sz) - start, POSIX_MADV_WILLNEED);
+}
+
+}
+
 DirectIORandRead::DirectIORandRead(const std::string & fileName)
     : _file(std::make_unique<FastOS_File>(fileName.c_str())),
       _alignment(1),
@@ -88,6 +173,12 @@ MMapRandRead::read(size_t offset, vespalib::DataBuffer & buffer, size_t sz)
     return FSP();
 }
 
+void
+MMapRandRead::prefetch(size_t offset, size_t sz)
+{
+    adviseWillNeed(*_file, offset, sz);
+}
+
 int64_t
 MMapRandRead::getSize() const {
     return _file->getSize();
@@ -146,6 +237,13 @@ MMapRandReadDynamic::read(size_t offset, vespalib::DataBuffer & buffer, size_t s
     return file;
 }
 
+void
+MMapRandReadDynamic::prefetch(size_t offset, size_t sz)
+{
+    FSP file(_holder.get());
+    adviseWillNeed(*file, offset, sz);
+}
+
 bool
 MMapRandReadDynamic::contains(const FastOS_FileInterface & file, size_t sz) {
     return (sz == 0) || (file.MemoryMapPtr(sz - 1) != nullptr);
@@ -173,4 +271,154 @@ NormalRandRead::getSize() const
     return _file->getSize();
 }
 
+UringRandRead::UringRandRead(const std::string & fileName)
+    : _file(std::make_unique<vespalib::File>(fileName))
+{
+    _file->open(vespalib::File::READONLY);
+}
+
+UringRandRead::~UringRandRead() = default;
+
+bool
+UringRandRead::isSupported()
+{
+#ifdef VESPA_HAS_IO_URING
+    static const bool supported = probeUring();
+    return supported;
+#else
+    return false;
+#endif
+}
+
+void
+UringRandRead::readSync(const ReadRequest & request, size_t done)
+{
+    while (done < request.sz) {
+        size_t got = _file->read(request.buffer->getFree() + done, request.sz - done, request.offset + done);
+        if (got == 0) {
+            throw IoException(make_string("Short read of %zu bytes at offset %zu from '%s', got %zu",
+                                          request.sz, request.offset, _file->getFilename().c_str(), done),
+                              IoException::CORRUPT_DATA, VESPA_STRLOC);
+        }
+        done += got;
+    }
+    request.buffer->moveFreeToData(request.sz);
+}
+
+FileRandRead::FSP
+UringRandRead::read(size_t offset, vespalib::DataBuffer & buffer, size_t sz)
+{
+    buffer.clear();
+    buffer.ensureFree(sz);
+    readSync(ReadRequest{offset, sz, &buffer}, 0);
+    return FSP();
+}
+
+void
+UringRandRead::prefetch(size_t offset, size_t sz)
+{
+    posix_fadvise(_file->getFileDescriptor(), offset, sz, POSIX_FADV_WILLNEED);
+}
+
+std::vector<FileRandRead::FSP>
+UringRandRead::readMany(std::span<const ReadRequest> requests)
+{
+    for (const ReadRequest & request : requests) {
+        request.buffer->clear();
+        request.buffer->ensureFree(request.sz);
+    }
+#ifdef VESPA_HAS_IO_URING
+    ThreadRing & tr = threadRing();
+    if (tr.valid && (requests.size() > 1)) {
+        const int fd = _file->getFileDescriptor();
+        std::exception_ptr failure;
+        std::vector<bool> completed(requests.size(), false);
+        auto complete = [&](io_uring_cqe *cqe) {
+            size_t idx = reinterpret_cast<uintptr_t>(io_uring_cqe_get_data(cqe));
+            int result = cqe->res;
+            io_uring_cqe_seen(&tr.ring, cqe);
+            completed[idx] = true;
+            if (failure) {
+                return;
+            }
+            try {
+                // Short or failed reads are completed with pread, which also reports any real error.
+                readSync(requests[idx], (result > 0) ? size_t(result) : 0u);
+            } catch (...) {
+                failure = std::current_exception();
+            }
+        };
+        size_t next(0);
+        size_t inFlight(0);
+        while ((next < requests.size()) || (inFlight > 0)) {
+            while ( ! failure && (next < requests.size())) {
+                io_uring_sqe *sqe = io_uring_get_sqe(&tr.ring);
+                if (sqe == nullptr) {
+                    break;
+                }
+                const ReadRequest & request = requests[next];
+                io_uring_prep_read(sqe, fd, request.buffer->getFree(), request.sz, request.offset);
+                io_uring_sqe_set_data(sqe, reinterpret_cast<void *>(next));
+                ++next;
+                ++inFlight;
+            }
+            if (inFlight == 0) {
+                break;
+            }
+            int res = io_uring_submit_and_wait(&tr.ring, 1);
+            if (res < 0) {
+                if ((res == -EINTR) || (res == -EAGAIN) || (res == -EBUSY)) {
+                    continue;
+                }
+                LOG(warning, "io_uring_submit_and_wait failed for '%s': %s. Completing reads with pread",
+                    _file->getFilename().c_str(), strerror(-res));
+                // Reads already submitted land in the caller's buffers, so they must be reaped before
+                // falling back to pread. Reads not yet submitted are dropped with the ring.
+                inFlight -= io_uring_sq_ready(&tr.ring);
+                while (inFlight > 0) {
+                    io_uring_cqe *cqe = nullptr;
+                    int waitRes = io_uring_wait_cqe(&tr.ring, &cqe);
+                    if (waitRes == -EINTR) {
+                        continue;
+                    }
+                    if (waitRes < 0) {
+                        // There is no way to tell when the reads into the caller's buffers are done.
+                        LOG_ABORT(make_string("io_uring_wait_cqe failed for '%s': %s",
+                                              _file->getFilename().c_str(), strerror(-waitRes)).c_str());
+                    }
+                    complete(cqe);
+                    --inFlight;
+                }
+                tr.reset();
+                break;
+            }
+            io_uring_cqe *cqe = nullptr;
+            while (io_uring_peek_cqe(&tr.ring, &cqe) == 0) {
+                complete(cqe);
+                --inFlight;
+            }
+        }
+        if (failure) {
+            std::rethrow_exception(failure);
+        }
+        for (size_t i(0); i < requests.size(); i++) {
+            if ( ! completed[i]) {
+                readSync(requests[i], 0);
+            }
+        }
+        return {};
+    }
+#endif
+    for (const ReadRequest & request : requests) {
+        readSync(request, 0);
+    }
+    return {};
+}
+
+int64_t
+UringRandRead::getSize() const
+{
+    return _file->getFileSize();
+}
+
 }
@@ -8,6 +8,8 @@
 
 class FastOS_FileInterface;
 
+namespace vespalib { class File; }
+
 namespace search {
 
 class DirectIORandRead : public FileRandRead
@@ -30,6 +32,7 @@ public:
     MMapRandRead(const std::string & fileName, int mmapFlags, int fadviseOptions);
     ~MMapRandRead() override;
     FSP read(size_t offset, vespalib::DataBuffer & buffer, size_t sz) override;
+    void prefetch(size_t offset, size_t sz) override;
     int64_t getSize() const override;
     const void * getMapping();
 private:
@@ -42,6 +45,7 @@ public:
     MMapRandReadDynamic(const std::string & fileName, int mmapFlags, int fadviseOptions);
     ~MMapRandReadDynamic() override;
     FSP read(size_t offset, vespalib::DataBuffer & buffer, size_t sz) override;
+    void prefetch(size_t offset, size_t sz) override;
     int64_t getSize() const override;
 private:
     static bool contains(const FastOS_FileInterface & file, size_t sz);
@@ -64,4 +68,26 @@ private:
     std::unique_ptr<FastOS_FileInterface>  _file;
 };
 
+/**
+ * Reads with pread, but batches submitted through readMany are issued
+ * together through io_uring so that many reads are in flight at once
+ * with a single context switch. Falls back to pread if io_uring is not
+ * available.
+ */
+class UringRandRead : public FileRandRead
+{
+public:
+    UringRandRead(const std::string & fileName);
+    ~UringRandRead() override;
+    FSP read(size_t offset, vespalib::DataBuffer & buffer, size_t sz) override;
+    std::vector<FSP> readMany(std::span<const ReadRequest> requests) override;
+    bool prefersBatchedReads() const override { return true; }
+    void prefetch(size_t offset, size_t sz) override;
+    int64_t getSize() const override;
+    static bool isSupported();
+private:
+    void readSync(const ReadRequest & request, size_t done);
+    std::unique_ptr<vespalib::File> _file;
+};
+
 }
@@ -81,7 +81,8 @@ WriteableFileChunk(vespalib::Executor &executor,
                    const Config &config,
                    const TuneFileSummary &tune,
                    const FileHeaderContext &fileHeaderContext,
-                   const IBucketizer * bucketizer)
+                   const IBucketizer * bucketizer,
+                   std::shared_ptr<const vespalib::compression::ZStdDictionary> dictionary)
     : FileChunk(fileId, nameId, baseName, tune, bucketizer),
       _config(config),
       _serialNum(initialSerialNum),
@@ -111,6 +112,7 @@ WriteableFileChunk(vespalib::Executor &executor,
       _bucketMap(bucketizer)
 {
     _docIdLimit = docIdLimit;
+    _dictionary = std::move(dictionary);
     if (tune._write.getWantDirectIO()) {
         _dataFile.EnableDirectIO();
     }
@@ -255,16 +257,43 @@ WriteableFileChunk::read(LidInfoWithLidV::const_iterator begin, size_t count, IB
             visitor.visit(entry._lid, vespalib::ConstBufferRef(entry._buf.get(), entry._size));
             entry._buf = vespalib::alloc::Alloc();
         }
+        std::vector<ChunkLids> chunks;
+        chunks.reserve(chunksOnFile.size());
         for (auto & it : chunksOnFile) {
             auto first = find_first(begin, it.first);
             auto last = seek_past(first, begin + count, it.first);
-            FileChunk::read(first, last - first, it.second, visitor);
+            chunks.push_back({first, size_t(last - first), it.second});
         }
+        readChunks(chunks, visitor);
     } else {
         FileChunk::read(begin, count, visitor);
     }
 }
 
+void
+WriteableFileChunk::prefetch(LidInfoWithLidV::const_iterator begin, size_t count) const
+{
+    if (frozen()) {
+        FileChunk::prefetch(begin, count);
+        return;
+    }
+    // Chunks not yet on file are already in memory.
+    std::vector<ChunkInfo> chunksOnFile;
+    {
+        std::lock_guard guard(_lock);
+        for (size_t i(0); i < count; i++) {
+            uint32_t chunk = (begin + i)->getChunkId();
+            bool sameAsPrev = (i > 0) && (chunk == (begin + i - 1)->getChunkId());
+            if (!sameAsPrev && (chunk < _chunkInfo.size()) && _chunkInfo[chunk].valid()) {
+                chunksOnFile.push_back(_chunkInfo[chunk]);
+            }
+        }
+    }
+    for (const ChunkInfo & chunkInfo : chunksOnFile) {
+        prefetchChunk(chunkInfo);
+    }
+}
+
 ssize_t
 WriteableFileChunk::read(uint32_t lid, SubChunkId chunkId, vespalib::DataBuffer & buffer) const
 {
@@ -301,7 +330,7 @@ WriteableFileChunk::internalFlush(uint32_t chunkId, uint64_t serialNum, CpuUsage
         tmp->getBuf().ensureFree(active->getMaxPackSize(_config.getCompression()) + _alignment - 1);
     }
     auto old_size = active->size(); // uncompressed data size already tentatively accounted for by append
-    active->pack(serialNum, tmp->getBuf(), _config.getCompression());
+    active->pack(serialNum, tmp->getBuf(), _config.getCompression(), _dictionary.get());
     tmp->setPayLoad();
     if (_alignment > 1) {
         const size_t padAfter((_alignment - tmp->getPayLoad() % _alignment) % _alignment);
@@ -765,6 +794,9 @@ WriteableFileChunk::readDataHeader()
         FileHeader h;
         _dataHeaderLen = h.readFile(_dataFile);
         _dataFile.SetPosition(_dataHeaderLen);
+        if ( ! _dictionary) {
+            _dictionary = readDictionary(h);
+        }
     } catch (IllegalHeaderException &e) {
         _dataFile.SetPosition(0);
         try {
@@ -831,6 +863,9 @@ WriteableFileChunk::writeDataHeader(const FileHeaderContext &fileHeaderContext)
     assert(_dataFile.getPosition() == 0);
     fileHeaderContext.addTags(h, _dataFile.GetFileName());
     h.putTag(Tag("desc", "Log data store chunk data"));
+    if (_dictionary) {
+        writeDictionary(h, *_dictionary);
+    }
     _dataHeaderLen = h.writeFile(_dataFile);
 }
 
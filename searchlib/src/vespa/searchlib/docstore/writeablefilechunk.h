@@ -46,11 +46,13 @@ public:
                        const std::string & baseName, uint64_t initialSerialNum,
                        uint32_t docIdLimit, const Config & config,
                        const TuneFileSummary &tune, const common::FileHeaderContext &fileHeaderContext,
-                       const IBucketizer * bucketizer);
+                       const IBucketizer * bucketizer,
+                       std::shared_ptr<const vespalib::compression::ZStdDictionary> dictionary = {});
     ~WriteableFileChunk() override;
 
     ssize_t read(uint32_t lid, SubChunkId chunk, vespalib::DataBuffer & buffer) const override;
     void read(LidInfoWithLidV::const_iterator begin, size_t count, IBufferVisitor & visitor) const override;
+    void prefetch(LidInfoWithLidV::const_iterator begin, size_t count) const override;
 
     LidInfo append(uint64_t serialNum, uint32_t lid, vespalib::ConstBufferRef data,
                    vespalib::CpuUsage::Category cpu_category);
@@ -18,6 +18,7 @@ public:
     AggregationRefNode & operator = (const AggregationRefNode & exprref);
 
     ExpressionNode *getExpression() { return _expressionNode; }
+    const ExpressionNode *getExpression() const { return _expressionNode; }
     const ResultNode * getResult() const override { return _expressionNode->getResult(); }
     void onPrepare(bool preserveAccurateTypes) override { _expressionNode->prepare(preserveAccurateTypes); }
     bool onExecute() const override;
@@ -121,6 +121,8 @@ public:
         o[3].as_number = 1;  // count
     }
     void execute(uint32_t docId) override;
+    bool supports_execute_block() const override { return true; }
+    void execute_block(std::span<const uint32_t> docids, std::span<feature_t> result) override;
 };
 
 class BoolAttributeExecutor final : public fef::FeatureExecutor {
@@ -236,6 +238,18 @@ SingleAttributeExecutor<T>::execute(uint32_t docId)
                      : util::getAsFeature(v);
 }
 
+template <typename T>
+void
+SingleAttributeExecutor<T>::execute_block(std::span<const uint32_t> docids, std::span<feature_t> result)
+{
+    for (size_t i = 0; i < docids.size(); ++i) {
+        typename T::LoadedValueType v = _attribute.getFast(docids[i]);
+        result[i] = __builtin_expect(attribute::isUndefined(v), false)
+                    ? attribute::getUndefined<feature_t>()
+                    : util::getAsFeature(v);
+    }
+}
+
 template <typename BaseType>
 void
 ArrayAttributeExecutor<BaseType>::execute(uint32_t docId)
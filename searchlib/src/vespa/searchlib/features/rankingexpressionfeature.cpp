@@ -2,12 +2,18 @@
 
 #include "rankingexpressionfeature.h"
 #include "utils.h"
+#include <vespa/searchlib/fef/featurenameparser.h>
 #include <vespa/searchlib/fef/properties.h>
 #include <vespa/searchlib/fef/indexproperties.h>
 #include <vespa/searchlib/features/rankingexpression/feature_name_extractor.h>
+#include <vespa/eval/eval/basic_nodes.h>
+#include <vespa/eval/eval/node_tools.h>
+#include <vespa/eval/eval/node_traverser.h>
 #include <vespa/eval/eval/param_usage.h>
 #include <vespa/eval/eval/fast_value.h>
 #include <vespa/vespalib/util/stringfmt.h>
+#include <map>
+#include <optional>
 
 #include <vespa/log/log.h>
 LOG_SETUP(".features.rankingexpression");
@@ -20,11 +26,13 @@ using vespalib::eval::FastValueBuilderFactory;
 using vespalib::eval::Function;
 using vespalib::eval::InterpretedFunction;
 using vespalib::eval::LazyParams;
+using vespalib::eval::NodeTools;
 using vespalib::eval::NodeTypes;
 using vespalib::eval::PassParams;
 using vespalib::eval::Value;
 using vespalib::eval::ValueType;
 using vespalib::eval::gbdt::FastForest;
+using vespalib::eval::nodes::Node_UP;
 
 namespace search::features {
 
@@ -38,6 +46,132 @@ std::string list_issues(const std::vector<std::string> &issues) {
     return result;
 }
 
+// Retrieve and concatenate whatever config is available for the given ranking expression feature.
+std::optional<std::string> lookup_script(const fef::IIndexEnvironment &env, const std::string &name) {
+    fef::Property property = env.getProperties().lookup(name, "rankingScript");
+    fef::Property expr_name = env.getProperties().lookup(name, "expressionName");
+    if (property.size() > 0) {
+        std::string script;
+        for (uint32_t i = 0; i < property.size(); ++i) {
+            script.append(property.getAt(i));
+        }
+        return script;
+    } else if (expr_name.size() == 1) {
+        return env.getRankingExpression(expr_name.get());
+    }
+    return std::nullopt;
+}
+
+// Counts how many times each parameter is referenced in a function.
+struct ParamRefCounter : vespalib::eval::NodeTraverser {
+    std::vector<size_t> counts;
+    explicit ParamRefCounter(size_t num_params) : counts(num_params, 0) {}
+    bool open(const vespalib::eval::nodes::Node &) override { return true; }
+    void close(const vespalib::eval::nodes::Node &node) override {
+        if (auto symbol = vespalib::eval::nodes::as<vespalib::eval::nodes::Symbol>(node)) {
+            ++counts[symbol->id()];
+        }
+    }
+};
+
+/**
+ * Replaces parameters referencing other ranking expression features
+ * (rankingExpression(foo)) with the expressions they contain. This
+ * lets a chain of ranking expressions be compiled into a single
+ * function instead of being evaluated by one executor each.
+ * Expressions that cannot be copied (tensor expressions) are left as
+ * parameters, as are gbdt forests when fast forest evaluation is used.
+ * Only expressions referenced exactly once (counting all references
+ * from all reachable expressions) are inlined, since inlining a shared
+ * expression would evaluate it once per reference.
+ **/
+class ExpressionInliner {
+private:
+    static constexpr size_t max_depth = 16;
+
+    const fef::IIndexEnvironment  &_env;
+    bool                           _keep_forests;
+    std::vector<std::string>       _params;
+    std::map<std::string, size_t>  _param_ids;
+    size_t                         _num_inlined;
+    std::map<std::string, size_t>  _ref_counts;
+    std::map<std::string, std::shared_ptr<Function const>> _nested;
+
+    Node_UP make_param(const std::string &name) {
+        auto ins = _param_ids.emplace(name, _params.size());
+        if (ins.second) {
+            _params.push_back(name);
+        }
+        return std::make_unique<vespalib::eval::nodes::Symbol>(ins.first->second);
+    }
+    void revert_params(size_t num_params) {
+        while (_params.size() > num_params) {
+            _param_ids.erase(_params.back());
+            _params.pop_back();
+        }
+    }
+    std::shared_ptr<Function const> resolve_nested(const std::string &name) const {
+        fef::FeatureNameParser parser(name);
+        if (!parser.valid() || parser.baseName() != "rankingExpression" || parser.parameters().size() != 1 ||
+            !(parser.output().empty() || parser.output() == "out"))
+        {
+            return {};
+        }
+        auto script = lookup_script(_env, parser.executorName());
+        auto function = Function::parse(script.value_or(parser.parameters()[0]), rankingexpression::FeatureNameExtractor());
+        if (function->has_error() || (_keep_forests && FastForest::try_convert(*function))) {
+            return {};
+        }
+        return function;
+    }
+    // Visits each reachable nested expression once, counting references to it.
+    void count_refs(const Function &function, size_t depth) {
+        ParamRefCounter counter(function.num_params());
+        function.root().traverse(counter);
+        for (size_t id = 0; id < function.num_params(); ++id) {
+            const auto &name = function.param_name(id);
+            _ref_counts[name] += counter.counts[id];
+            if ((depth < max_depth) && !_nested.contains(name)) {
+                auto nested = resolve_nested(name);
+                _nested.emplace(name, nested);
+                if (nested) {
+                    count_refs(*nested, depth + 1);
+                }
+            }
+        }
+    }
+    Node_UP inline_params(const Function &function, size_t depth) {
+        return NodeTools::copy(function.root(), [&](size_t id) -> Node_UP {
+            const auto &name = function.param_name(id);
+            auto nested = _nested.find(name);
+            if ((depth < max_depth) && (nested != _nested.end()) && nested->second && (_ref_counts[name] == 1)) {
+                size_t num_params = _params.size();
+                auto node = inline_params(*nested->second, depth + 1);
+                if (vespalib::eval::nodes::as<vespalib::eval::nodes::Error>(*node) == nullptr) {
+                    ++_num_inlined;
+                    return node;
+                }
+                revert_params(num_params);
+            }
+            return make_param(name);
+        });
+    }
+public:
+    ExpressionInliner(const fef::IIndexEnvironment &env, bool keep_forests)
+        : _env(env), _keep_forests(keep_forests), _params(), _param_ids(), _num_inlined(0),
+          _ref_counts(), _nested() {}
+    size_t num_inlined() const { return _num_inlined; }
+    // returns nullptr if nothing could be inlined
+    std::shared_ptr<Function const> inline_nested(const Function &function) {
+        count_refs(function, 0);
+        auto root = inline_params(function, 0);
+        if ((_num_inlined == 0) || (vespalib::eval::nodes::as<vespalib::eval::nodes::Error>(*root) != nullptr)) {
+            return {};
+        }
+        return Function::create(std::move(root), _params);
+    }
+};
+
 } // namespace search::features::<unnamed>
 
 //-----------------------------------------------------------------------------
@@ -51,11 +185,15 @@ private:
     const FastForest &_forest;
     FastForest::Context::UP _ctx;
     std::span<float> _params;
+    std::vector<double> _block_inputs;
+    std::vector<float> _block_params;
 
 public:
     FastForestExecutor(std::span<float> param_space, const FastForest &forest);
     bool isPure() override { return true; }
     void execute(uint32_t docId) override;
+    bool supports_execute_block() const override;
+    void execute_block(std::span<const uint32_t> docids, std::span<feature_t> result) override;
 };
 
 //-----------------------------------------------------------------------------
@@ -69,11 +207,14 @@ private:
     typedef double (*arr_function)(const double *);
     arr_function _ranking_function;
     std::vector<double> _params;
+    std::vector<double> _block_params;
 
 public:
     CompiledRankingExpressionExecutor(const CompiledFunction &compiled_function);
     bool isPure() override { return true; }
     void execute(uint32_t docId) override;
+    bool supports_execute_block() const override;
+    void execute_block(std::span<const uint32_t> docids, std::span<feature_t> result) override;
 };
 
 //-----------------------------------------------------------------------------
@@ -149,7 +290,9 @@ public:
 FastForestExecutor::FastForestExecutor(std::span<float> param_space, const FastForest &forest)
     : _forest(forest),
       _ctx(_forest.create_context()),
-      _params(param_space)
+      _params(param_space),
+      _block_inputs(),
+      _block_params()
 {
 }
 
@@ -169,11 +312,41 @@ FastForestExecutor::execute(uint32_t)
     outputs().set_number(0, _forest.eval(*_ctx, &_params[0]));
 }
 
+bool
+FastForestExecutor::supports_execute_block() const
+{
+    for (const auto &input: inputs().get_bound()) {
+        if (!input.supports_block()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void
+FastForestExecutor::execute_block(std::span<const uint32_t> docids, std::span<feature_t> result)
+{
+    // the forest wants the parameters for each document after each other
+    size_t num_docs = docids.size();
+    size_t num_params = _params.size();
+    _block_inputs.resize(num_docs);
+    _block_params.resize(num_params * num_docs);
+    auto inputs_in = inputs().get_bound();
+    for (size_t p = 0; p < num_params; ++p) {
+        inputs_in[p].as_numbers(docids, _block_inputs);
+        for (size_t i = 0; i < num_docs; ++i) {
+            _block_params[(i * num_params) + p] = _block_inputs[i];
+        }
+    }
+    _forest.eval_batch(*_ctx, _block_params.data(), num_params, num_docs, result.data());
+}
+
 //-----------------------------------------------------------------------------
 
 CompiledRankingExpressionExecutor::CompiledRankingExpressionExecutor(const CompiledFunction &compiled_function)
     : _ranking_function(compiled_function.get_function()),
-      _params(compiled_function.num_params(), 0.0)
+      _params(compiled_function.num_params(), 0.0),
+      _block_params()
 {
 }
 
@@ -193,6 +366,37 @@ CompiledRankingExpressionExecutor::execute(uint32_t)
     outputs().set_number(0, _ranking_function(_params.data()));
 }
 
+bool
+CompiledRankingExpressionExecutor::supports_execute_block() const
+{
+    for (const auto &input: inputs().get_bound()) {
+        if (!input.supports_block()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void
+CompiledRankingExpressionExecutor::execute_block(std::span<const uint32_t> docids, std::span<feature_t> result)
+{
+    // calculate one column of parameter values per input, then evaluate row by row
+    size_t num_docs = docids.size();
+    size_t num_params = _params.size();
+    _block_params.resize(num_params * num_docs);
+    auto inputs_in = inputs().get_bound();
+    for (size_t p = 0; p < num_params; ++p) {
+        inputs_in[p].as_numbers(docids, std::span<feature_t>(_block_params.data() + (p * num_docs), num_docs));
+    }
+    for (size_t i = 0; i < num_docs; ++i) {
+        const double *src = _block_params.data() + i;
+        for (size_t p = 0; p < num_params; ++p, src += num_docs) {
+            _params[p] = *src;
+        }
+        result[i] = _ranking_function(_params.data());
+    }
+}
+
 //-----------------------------------------------------------------------------
 
 namespace {
@@ -275,16 +479,9 @@ bool
 RankingExpressionBlueprint::setup(const fef::IIndexEnvironment &env,
                                   const fef::ParameterList &params)
 {
-    // Retrieve and concatenate whatever config is available.
-    std::string script = "";
-    fef::Property property = env.getProperties().lookup(getName(), "rankingScript");
-    fef::Property expr_name = env.getProperties().lookup(getName(), "expressionName");
-    if (property.size() > 0) {
-        for (uint32_t i = 0; i < property.size(); ++i) {
-            script.append(property.getAt(i));
-        }
-    } else if (expr_name.size() == 1) {
-        script = env.getRankingExpression(expr_name.get());
+    std::string script;
+    if (auto configured = lookup_script(env, getName())) {
+        script = std::move(configured.value());
     } else if (params.size() == 1) {
         script = params[0].getValue();
     } else {
@@ -300,6 +497,13 @@ RankingExpressionBlueprint::setup(const fef::IIndexEnvironment &env,
         describeOutput("out", "result of intrinsic expression", _intrinsic_expression->result_type());
         return true;
     }
+    if (fef::indexproperties::eval::InlineExpressions::check(env.getProperties())) {
+        ExpressionInliner inliner(env, fef::indexproperties::eval::UseFastForest::check(env.getProperties()));
+        if (auto inlined = inliner.inline_nested(*rank_function)) {
+            LOG(debug, "%s: inlined %zu nested ranking expressions", getName().c_str(), inliner.num_inlined());
+            rank_function = std::move(inlined);
+        }
+    }
     bool do_compile = true;
     bool dependency_error = false;
     std::vector<ValueType> input_types;
@@ -20,6 +20,21 @@ FeatureExecutor::isPure()
     return false;
 }
 
+bool
+FeatureExecutor::supports_execute_block() const
+{
+    return false;
+}
+
+void
+FeatureExecutor::execute_block(std::span<const uint32_t> docids, std::span<feature_t> result)
+{
+    for (size_t i = 0; i < docids.size(); ++i) {
+        lazy_execute(docids[i]);
+        result[i] = _outputs.get_number(0);
+    }
+}
+
 void
 FeatureExecutor::handle_bind_inputs(std::span<const LazyValue>)
 {
@@ -32,6 +32,9 @@ public:
     }
     inline double as_number(uint32_t docid) const;
     inline vespalib::eval::Value::CREF as_object(uint32_t docid) const;
+    // true if values for blocks of documents can be calculated without match data
+    inline bool supports_block() const;
+    inline void as_numbers(std::span<const uint32_t> docids, std::span<feature_t> result) const;
 };
 
 /**
@@ -51,6 +54,7 @@ public:
         void set_docid(uint32_t docid) { _docid = docid; }
         uint32_t get_docid() const { return _docid; }
         void bind(std::span<const LazyValue> inputs) { _inputs = inputs; }
+        std::span<const LazyValue> get_bound() const { return _inputs; }
         inline feature_t get_number(size_t idx) const;
         inline vespalib::eval::Value::CREF get_object(size_t idx) const;
         size_t size() const { return _inputs.size(); }
@@ -148,6 +152,33 @@ public:
      **/
     virtual bool isPure();
 
+    /**
+     * Check if this feature executor is able to calculate its first
+     * output for a block of documents at once in a way that is more
+     * efficient than calculating it for one document at a time. A
+     * feature executor claiming to support this must not depend on
+     * match data, neither directly nor through its inputs. Match
+     * data is unpacked for each document as it is added to a block,
+     * but when the block is evaluated it only holds the values
+     * unpacked for the last document in the block. This method
+     * returns false by default.
+     *
+     * @return true if execute_block is supported
+     **/
+    virtual bool supports_execute_block() const;
+
+    /**
+     * Calculate the first output of this executor for all the given
+     * documents. Overriding implementations should write the results
+     * directly into the result array and leave the outputs of this
+     * executor untouched. The default implementation executes this
+     * executor for one document at a time.
+     *
+     * @param docids the local document ids being evaluated, in increasing order
+     * @param result where to store the value calculated for each document
+     **/
+    virtual void execute_block(std::span<const uint32_t> docids, std::span<feature_t> result);
+
     /**
      * Make sure this executor has been executed for the given
      * document.
@@ -181,6 +212,25 @@ vespalib::eval::Value::CREF LazyValue::as_object(uint32_t docid) const {
     return _value->as_object;
 }
 
+bool LazyValue::supports_block() const {
+    return ((_executor == nullptr) ||
+            ((_value == _executor->outputs().get_raw(0)) && _executor->supports_execute_block()));
+}
+
+void LazyValue::as_numbers(std::span<const uint32_t> docids, std::span<feature_t> result) const {
+    if (_executor == nullptr) {
+        for (feature_t &value: result) {
+            value = _value->as_number;
+        }
+    } else if (_value == _executor->outputs().get_raw(0)) {
+        _executor->execute_block(docids, result);
+    } else {
+        for (size_t i = 0; i < docids.size(); ++i) {
+            result[i] = as_number(docids[i]);
+        }
+    }
+}
+
 feature_t FeatureExecutor::Inputs::get_number(size_t idx) const {
     return _inputs[idx].as_number(_docid);
 }
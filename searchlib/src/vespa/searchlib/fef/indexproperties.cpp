@@ -100,6 +100,10 @@ const std::string UseFastForest::NAME("vespa.eval.use_fast_forest");
 const bool UseFastForest::DEFAULT_VALUE(false);
 bool UseFastForest::check(const Properties &props) { return lookupBool(props, NAME, DEFAULT_VALUE); }
 
+const std::string InlineExpressions::NAME("vespa.eval.inline_expressions");
+const bool InlineExpressions::DEFAULT_VALUE(false);
+bool InlineExpressions::check(const Properties &props) { return lookupBool(props, NAME, DEFAULT_VALUE); }
+
 } // namespace eval
 
 namespace rank {
@@ -326,6 +330,12 @@ Feature::lookup(const Properties &props)
     return lookupStringVector(props, NAME, DEFAULT_VALUE);
 }
 
+const std::string Prefetch::NAME("vespa.summary.prefetch");
+const bool Prefetch::DEFAULT_VALUE(false);
+bool Prefetch::check(const Properties &props, bool fallback) {
+    return lookupBool(props, NAME, fallback);
+}
+
 } // namespace summary
 
 namespace dump {
@@ -502,6 +512,18 @@ bool AlwaysMarkPhraseExpensive::check(const Properties &props, bool fallback) {
     return lookupBool(props, NAME, fallback);
 }
 
+const std::string WorkStealing::NAME("vespa.matching.work_stealing");
+const bool WorkStealing::DEFAULT_VALUE(false);
+bool WorkStealing::check(const Properties &props, bool fallback) {
+    return lookupBool(props, NAME, fallback);
+}
+
+const std::string BlockScoring::NAME("vespa.matching.block_scoring");
+const bool BlockScoring::DEFAULT_VALUE(false);
+bool BlockScoring::check(const Properties &props, bool fallback) {
+    return lookupBool(props, NAME, fallback);
+}
+
 } // namespace matching
 
 namespace softtimeout {
@@ -685,6 +707,21 @@ ArraySize::lookup(const Properties &props, uint32_t defaultValue)
     return lookupUint32(props, NAME, defaultValue);
 }
 
+const std::string TopKBatchSize::NAME("vespa.hitcollector.topkbatchsize");
+const uint32_t TopKBatchSize::DEFAULT_VALUE(0);
+
+uint32_t
+TopKBatchSize::lookup(const Properties &props)
+{
+    return lookup(props, DEFAULT_VALUE);
+}
+
+uint32_t
+TopKBatchSize::lookup(const Properties &props, uint32_t defaultValue)
+{
+    return lookupUint32(props, NAME, defaultValue);
+}
+
 const std::string EstimatePoint::NAME("vespa.hitcollector.estimatepoint");
 const uint32_t EstimatePoint::DEFAULT_VALUE(0xffffffff);
 
@@ -733,8 +770,42 @@ SecondPhaseRankScoreDropLimit::lookup(const Properties &props, std::optional<fea
     return lookup_opt_double(props, NAME, default_value);
 }
 
+const std::string EarlyTerminationFactor::NAME("vespa.hitcollector.earlyterminationfactor");
+const double EarlyTerminationFactor::DEFAULT_VALUE(0.0);
+
+double
+EarlyTerminationFactor::lookup(const Properties &props)
+{
+    return lookup(props, DEFAULT_VALUE);
+}
+
+double
+EarlyTerminationFactor::lookup(const Properties &props, double defaultValue)
+{
+    return lookupDouble(props, NAME, defaultValue);
+}
+
 } // namspace hitcollector
 
+namespace grouping {
+
+const std::string ApproximationFactor::NAME("vespa.grouping.approximationfactor");
+const uint32_t ApproximationFactor::DEFAULT_VALUE(0);
+
+uint32_t
+ApproximationFactor::lookup(const Properties &props)
+{
+    return lookup(props, DEFAULT_VALUE);
+}
+
+uint32_t
+ApproximationFactor::lookup(const Properties &props, uint32_t defaultValue)
+{
+    return lookupUint32(props, NAME, defaultValue);
+}
+
+} // namespace grouping
+
 
 const std::string FieldWeight::BASE_NAME("vespa.fieldweight.");
 const uint32_t FieldWeight::DEFAULT_VALUE(100);
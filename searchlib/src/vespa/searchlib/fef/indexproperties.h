@@ -36,6 +36,14 @@ struct UseFastForest {
     static bool check(const Properties &props);
 };
 
+// inline nested ranking expressions referenced only once into the expressions using them,
+// compiling a chain of expressions into a single function. affects rank/summary/dump
+struct InlineExpressions {
+    static const std::string NAME;
+    static const bool DEFAULT_VALUE;
+    static bool check(const Properties &props);
+};
+
 } // namespace eval
 
 namespace rank {
@@ -100,6 +108,18 @@ namespace summary {
         static std::vector<std::string> lookup(const Properties &props);
     };
 
+    /**
+     * When enabled, the document store is told to start fetching the
+     * documents of the likely top hits while second phase ranking runs,
+     * so that a following docsum request finds them in memory.
+     **/
+    struct Prefetch {
+        static const std::string NAME;
+        static const bool DEFAULT_VALUE;
+        static bool check(const Properties &props) { return check(props, DEFAULT_VALUE); }
+        static bool check(const Properties &props, bool fallback);
+    };
+
 } // namespace summary
 
 namespace dump {
@@ -393,6 +413,30 @@ namespace matching {
         static bool check(const Properties &props) { return check(props, DEFAULT_VALUE); }
         static bool check(const Properties &props, bool fallback);
     };
+
+    /**
+     * When enabled, the search threads balance the docid space between
+     * them by stealing work from each other instead of using the
+     * scheduler selected by the number of search partitions.
+     **/
+    struct WorkStealing {
+        static const std::string NAME;
+        static const bool DEFAULT_VALUE;
+        static bool check(const Properties &props) { return check(props, DEFAULT_VALUE); }
+        static bool check(const Properties &props, bool fallback);
+    };
+
+    /**
+     * When enabled, and the first phase score supports it, the first
+     * phase score is calculated for blocks of matching documents at a
+     * time instead of one document at a time.
+     **/
+    struct BlockScoring {
+        static const std::string NAME;
+        static const bool DEFAULT_VALUE;
+        static bool check(const Properties &props) { return check(props, DEFAULT_VALUE); }
+        static bool check(const Properties &props, bool fallback);
+    };
 }
 
 namespace softtimeout {
@@ -566,6 +610,19 @@ namespace hitcollector {
         static uint32_t lookup(const Properties &props, uint32_t defaultValue);
     };
 
+    /**
+     * Property for the number of candidate hits the hit collector buffers
+     * before merging them into the best hits with a single selection pass.
+     * 0 means that every candidate is pushed through a heap right away.
+     * Values below the number of hits kept are raised to that number.
+     **/
+    struct TopKBatchSize {
+        static const std::string NAME;
+        static const uint32_t DEFAULT_VALUE;
+        static uint32_t lookup(const Properties &props);
+        static uint32_t lookup(const Properties &props, uint32_t defaultValue);
+    };
+
     /**
      * Property for the estimate point used in parallel query evaluation.
      * Specifies when to estimate the total number of hits.
@@ -610,8 +667,37 @@ namespace hitcollector {
         static std::optional<feature_t> lookup(const Properties &props, std::optional<double> default_value);
     };
 
+    /**
+     * Property for early termination in streaming search. Stop matching
+     * documents when this many times the wanted number of hits have been
+     * collected, and report degraded coverage. 0 means match all documents.
+     **/
+    struct EarlyTerminationFactor {
+        static const std::string NAME;
+        static const double DEFAULT_VALUE;
+        static double lookup(const Properties &props);
+        static double lookup(const Properties &props, double defaultValue);
+    };
+
 } // namespace hitcollector
 
+namespace grouping {
+
+    /**
+     * Property for approximate top groups on grouping levels ordered by a
+     * descending count or sum. Groups are pruned down to the precision of the
+     * level each time there are this many times precision of them, instead of
+     * materializing all groups. 0 means exact grouping.
+     **/
+    struct ApproximationFactor {
+        static const std::string NAME;
+        static const uint32_t DEFAULT_VALUE;
+        static uint32_t lookup(const Properties &props);
+        static uint32_t lookup(const Properties &props, uint32_t defaultValue);
+    };
+
+} // namespace grouping
+
 /**
  * Property for the field weight of a field.
  **/
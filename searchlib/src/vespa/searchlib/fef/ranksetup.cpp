@@ -46,6 +46,9 @@ RankSetup::RankSetup(const BlueprintFactory &factory, const IIndexEnvironment &i
       _numSearchPartitions(0),
       _heapSize(0),
       _arraySize(0),
+      _topKBatchSize(0),
+      _groupingApproximationFactor(0),
+      _earlyTerminationFactor(0.0),
       _estimatePoint(0),
       _estimateLimit(0),
       _degradationMaxHits(0),
@@ -65,6 +68,9 @@ RankSetup::RankSetup(const BlueprintFactory &factory, const IIndexEnvironment &i
       _compileError(false),
       _degradationAscendingOrder(false),
       _always_mark_phrase_expensive(false),
+      _work_stealing(false),
+      _block_scoring(false),
+      _prefetch_summary(false),
       _diversityAttribute(),
       _diversityMinGroups(1),
       _diversityCutoffFactor(10.0),
@@ -113,6 +119,9 @@ RankSetup::configure()
     setNumSearchPartitions(matching::NumSearchPartitions::lookup(_indexEnv.getProperties()));
     setHeapSize(hitcollector::HeapSize::lookup(_indexEnv.getProperties()));
     setArraySize(hitcollector::ArraySize::lookup(_indexEnv.getProperties()));
+    setTopKBatchSize(hitcollector::TopKBatchSize::lookup(_indexEnv.getProperties()));
+    setGroupingApproximationFactor(grouping::ApproximationFactor::lookup(_indexEnv.getProperties()));
+    setEarlyTerminationFactor(hitcollector::EarlyTerminationFactor::lookup(_indexEnv.getProperties()));
     setDegradationAttribute(matchphase::DegradationAttribute::lookup(_indexEnv.getProperties()));
     setDegradationOrderAscending(matchphase::DegradationAscendingOrder::lookup(_indexEnv.getProperties()));
     setDegradationMaxHits(matchphase::DegradationMaxHits::lookup(_indexEnv.getProperties()));
@@ -147,6 +156,9 @@ RankSetup::configure()
     _mutateAllowQueryOverride = mutate::AllowQueryOverride::check(_indexEnv.getProperties());
     _sort_blueprints_by_cost = matching::SortBlueprintsByCost::check(_indexEnv.getProperties());
     _always_mark_phrase_expensive = matching::AlwaysMarkPhraseExpensive::check(_indexEnv.getProperties());
+    _work_stealing = matching::WorkStealing::check(_indexEnv.getProperties());
+    _block_scoring = matching::BlockScoring::check(_indexEnv.getProperties());
+    _prefetch_summary = summary::Prefetch::check(_indexEnv.getProperties());
 }
 
 void
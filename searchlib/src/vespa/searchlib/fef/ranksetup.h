@@ -55,6 +55,9 @@ private:
     uint32_t                 _numSearchPartitions;
     uint32_t                 _heapSize;
     uint32_t                 _arraySize;
+    uint32_t                 _topKBatchSize;
+    uint32_t                 _groupingApproximationFactor;
+    double                   _earlyTerminationFactor;
     uint32_t                 _estimatePoint;
     uint32_t                 _estimateLimit;
     uint32_t                 _degradationMaxHits;
@@ -74,6 +77,9 @@ private:
     bool                     _compileError;
     bool                     _degradationAscendingOrder;
     bool                     _always_mark_phrase_expensive;
+    bool                     _work_stealing;
+    bool                     _block_scoring;
+    bool                     _prefetch_summary;
     std::string         _diversityAttribute;
     uint32_t                 _diversityMinGroups;
     double                   _diversityCutoffFactor;
@@ -220,6 +226,48 @@ public:
      **/
     uint32_t getArraySize() const { return _arraySize; }
 
+    /**
+     * Sets the number of candidate hits the hit collector buffers before selecting the best hits.
+     *
+     * @param topKBatchSize the batch size, 0 disables batching
+     **/
+    void setTopKBatchSize(uint32_t topKBatchSize) { _topKBatchSize = topKBatchSize; }
+
+    /**
+     * Returns the number of candidate hits the hit collector buffers before selecting the best hits.
+     *
+     * @return the batch size
+     **/
+    uint32_t getTopKBatchSize() const { return _topKBatchSize; }
+
+    /**
+     * Sets the factor used for approximate top groups in grouping.
+     *
+     * @param factor the approximation factor, 0 means exact grouping
+     **/
+    void setGroupingApproximationFactor(uint32_t factor) { _groupingApproximationFactor = factor; }
+
+    /**
+     * Returns the factor used for approximate top groups in grouping.
+     *
+     * @return the approximation factor
+     **/
+    uint32_t getGroupingApproximationFactor() const { return _groupingApproximationFactor; }
+
+    /**
+     * Sets the factor used for early termination in streaming search.
+     *
+     * @param factor the early termination factor, 0 means no early termination
+     **/
+    void setEarlyTerminationFactor(double factor) { _earlyTerminationFactor = factor; }
+
+    /**
+     * Returns the factor used for early termination in streaming search.
+     *
+     * @return the early termination factor
+     **/
+    double getEarlyTerminationFactor() const { return _earlyTerminationFactor; }
+
     /** get name of attribute to use for graceful degradation in match phase */
     std::string getDegradationAttribute() const {
         return _degradationAttribute;
@@ -477,6 +525,9 @@ public:
 
     bool allowMutateQueryOverride() const { return _mutateAllowQueryOverride; }
     bool sort_blueprints_by_cost() const noexcept { return _sort_blueprints_by_cost; }
+    bool work_stealing() const noexcept { return _work_stealing; }
+    bool block_scoring() const noexcept { return _block_scoring; }
+    bool prefetch_summary() const noexcept { return _prefetch_summary; }
 };
 
 }
@@ -8,6 +8,23 @@
 
 namespace search::queryeval {
 
+void
+HitCollector::mergePendingHits()
+{
+    if (_pendingHits.empty()) {
+        return;
+    }
+    // Keep the best _maxHitsSize of the heap and the pending hits. All pending hits beat the
+    // heap top they were compared against, so a single selection replaces one heap update per hit.
+    const size_t numHits = _hits.size();
+    _hits.insert(_hits.end(), _pendingHits.begin(), _pendingHits.end());
+    _pendingHits.clear();
+    std::nth_element(_hits.begin(), _hits.begin() + (numHits - 1), _hits.end(), ScoreComparator());
+    _hits.resize(numHits);
+    std::make_heap(_hits.begin(), _hits.end(), ScoreComparator());
+    _scoreOrder.clear();
+}
+
 void
 HitCollector::sortHitsByScore(size_t topn)
 {
@@ -35,11 +52,13 @@ HitCollector::sortHitsByDocId()
     }
 }
 
-HitCollector::HitCollector(uint32_t numDocs, uint32_t maxHitsSize)
+HitCollector::HitCollector(uint32_t numDocs, uint32_t maxHitsSize, uint32_t topKBatchSize)
     : _numDocs(numDocs),
       _maxHitsSize(std::min(maxHitsSize, numDocs)),
       _maxDocIdVectorSize((numDocs + 31) / 32),
+      _topKBatchSize((topKBatchSize > 0) ? std::max(topKBatchSize, _maxHitsSize) : 0),
       _hits(),
+      _pendingHits(),
       _hitsSortOrder(SortOrder::DOC_ID),
       _unordered(false),
       _docIdVector(),
@@ -85,6 +104,14 @@ HitCollector::BitVectorCollector<CollectRankedHit>::collect(uint32_t docId, feat
 
 void
 HitCollector::CollectorBase::replaceHitInVector(uint32_t docId, feature_t score) noexcept {
+    if (_hc._topKBatchSize > 0) {
+        // heap top is kept until the pending hits are merged, so it acts as a fixed threshold for the batch
+        _hc._pendingHits.emplace_back(docId, score);
+        if (_hc._pendingHits.size() >= _hc._topKBatchSize) {
+            _hc.mergePendingHits();
+        }
+        return;
+    }
     // replace lowest scored hit in hit vector
     std::pop_heap(_hc._hits.begin(), _hc._hits.end(), ScoreComparator());
     _hc._hits.back().first = docId;
@@ -118,6 +145,10 @@ HitCollector::RankedHitCollector::collectAndChangeCollector(uint32_t docId, feat
         hc._bitVector->setBit(docId);
         newCollector = std::make_unique<BitVectorCollector<true>>(hc);
     }
+    if (hc._topKBatchSize > 0) {
+        hc._pendingHits.reserve(hc._topKBatchSize);
+        hc._hits.reserve(hc._hits.size() + hc._topKBatchSize);
+    }
     // treat hit vector as a heap
     std::make_heap(hc._hits.begin(), hc._hits.end(), ScoreComparator());
     hc._hitsSortOrder = SortOrder::HEAP;
@@ -166,6 +197,7 @@ HitCollector::DocIdCollector<CollectRankedHit>::collectAndChangeCollector(uint32
 SortedHitSequence
 HitCollector::getSortedHitSequence(size_t max_hits)
 {
+    mergePendingHits();
     size_t num_hits = std::min(_hits.size(), max_hits);
     sortHitsByScore(num_hits);
     return {_hits.data(), _scoreOrder.data(), num_hits};
@@ -377,6 +409,7 @@ HitCollector::get_result_set(std::optional<double> second_phase_rank_drop_limit,
         dropped->clear();
     }
 
+    mergePendingHits();
     // destroys the heap property or score sort order
     sortHitsByDocId();
 
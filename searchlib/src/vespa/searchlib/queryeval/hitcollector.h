@@ -26,8 +26,10 @@ private:
     const uint32_t _numDocs;
     const uint32_t _maxHitsSize;
     const uint32_t _maxDocIdVectorSize;
+    const uint32_t _topKBatchSize;
 
     std::vector<Hit>            _hits;  // used as a heap when _hits.size == _maxHitsSize
+    std::vector<Hit>            _pendingHits; // candidates beating the heap top, not yet merged into _hits
     std::vector<uint32_t>       _scoreOrder; // Holds an indirection to the N best hits
     SortOrder                   _hitsSortOrder;
     bool                        _unordered;
@@ -119,6 +121,7 @@ private:
         void collect(uint32_t docId, feature_t score) override;
     };
 
+    VESPA_DLL_LOCAL void mergePendingHits();
     VESPA_DLL_LOCAL void sortHitsByScore(size_t topn);
     VESPA_DLL_LOCAL void sortHitsByDocId();
 
@@ -133,12 +136,22 @@ public:
      * range [0, numDocs>.  Doc id and rank score are stored for the n
      * (=maxHitsSize) best hits.
      *
+     * When topKBatchSize is non-zero, hits beating the worst of the
+     * best hits are buffered, and merged into the best hits with a
+     * single selection pass each time topKBatchSize of them are
+     * buffered. Otherwise each such hit replaces the worst hit in a
+     * heap right away. Since each merge is linear in the number of best
+     * hits, a batch size below maxHitsSize is raised to maxHitsSize.
+     *
      * @param numDocs
      * @param maxHitsSize
+     * @param topKBatchSize
      **/
-    HitCollector(uint32_t numDocs, uint32_t maxHitsSize);
+    HitCollector(uint32_t numDocs, uint32_t maxHitsSize, uint32_t topKBatchSize = 0);
     ~HitCollector();
 
+    uint32_t getTopKBatchSize() const noexcept { return _topKBatchSize; }
+
     /**
      * Adds the given hit to this collector.  Stores doc id and rank
      * score if the given hit is among the n (=maxHitsSize) best hits.
@@ -9,6 +9,8 @@
 using vespalib::typify_invoke;
 using vespalib::eval::TypifyCellType;
 using vespalib::eval::TypedCells;
+using vespalib::BFloat16;
+using vespalib::eval::CellType;
 using vespalib::eval::Int8Float;
 
 namespace search::tensor {
@@ -73,6 +75,7 @@ template class BoundAngularDistance<TemporaryVectorStore<Int8Float>>;
 template class BoundAngularDistance<ReferenceVectorStore<float>>;
 template class BoundAngularDistance<ReferenceVectorStore<double>>;
 template class BoundAngularDistance<ReferenceVectorStore<Int8Float>>;
+template class BoundAngularDistance<ReferenceVectorStore<BFloat16>>;
 
 template <typename FloatType>
 BoundDistanceFunction::UP
@@ -93,8 +96,31 @@ AngularDistanceFunctionFactory<FloatType>::for_insertion_vector(TypedCells lhs)
     }
 }
 
+template <>
+BoundDistanceFunction::UP
+AngularDistanceFunctionFactory<BFloat16>::for_query_vector(TypedCells lhs) const {
+    if (_reference_insertion_vector && lhs.type == CellType::BFLOAT16) {
+        using DFT = BoundAngularDistance<ReferenceVectorStore<BFloat16>>;
+        return std::make_unique<DFT>(lhs);
+    }
+    using DFT = BoundAngularDistance<TemporaryVectorStore<float>>;
+    return std::make_unique<DFT>(lhs);
+}
+
+template <>
+BoundDistanceFunction::UP
+AngularDistanceFunctionFactory<BFloat16>::for_insertion_vector(TypedCells lhs) const {
+    if (_reference_insertion_vector) {
+        using DFT = BoundAngularDistance<ReferenceVectorStore<BFloat16>>;
+        return std::make_unique<DFT>(lhs);
+    }
+    using DFT = BoundAngularDistance<TemporaryVectorStore<float>>;
+    return std::make_unique<DFT>(lhs);
+}
+
 template class AngularDistanceFunctionFactory<float>;
 template class AngularDistanceFunctionFactory<double>;
 template class AngularDistanceFunctionFactory<Int8Float>;
+template class AngularDistanceFunctionFactory<BFloat16>;
 
 }
@@ -5,6 +5,7 @@
 #include "distance_function.h"
 #include <vespa/eval/eval/typed_cells.h>
 #include <memory>
+#include <span>
 
 namespace search::tensor {
 
@@ -20,6 +21,7 @@ public:
     using UP = std::unique_ptr<BoundDistanceFunction>;
     using TypedCells = vespalib::eval::TypedCells;
     using Int8Float = vespalib::eval::Int8Float;
+    using BFloat16 = vespalib::BFloat16;
 
     BoundDistanceFunction() noexcept = default;
 
@@ -30,10 +32,14 @@ public:
 
     // calculate internal distance, early return allowed if > limit
     virtual double calc_with_limit(TypedCells rhs, double limit) const noexcept = 0;
+
+    // calculate internal distances to a batch of vectors, distances.size() must be equal to rhs.size()
+    virtual void calc_batch(std::span<const TypedCells> rhs, std::span<double> distances) const noexcept;
 protected:
     static const double *cast(const double * p) { return p; }
     static const float *cast(const float * p) { return p; }
     static const int8_t *cast(const Int8Float * p) { return reinterpret_cast<const int8_t *>(p); }
+    static const BFloat16 *cast(const BFloat16 * p) { return p; }
 };
 
 }
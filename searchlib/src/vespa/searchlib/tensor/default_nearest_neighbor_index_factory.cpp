@@ -34,11 +34,13 @@ DefaultNearestNeighborIndexFactory::make(const DocVectorAccess& vectors,
 {
     (void) vector_size;
     uint32_t m = params.max_links_per_node();
+    bool quantize_vectors = params.quantize_vectors() && QuantizedVectorStore::supports(cell_type);
     HnswIndexConfig cfg(m * 2,
                         m,
                         params.neighbors_to_explore_at_insert(),
                         10000,
-                        true);
+                        true,
+                        quantize_vectors);
     if (multi_vector_index) {
         return std::make_unique<HnswIndex<HnswIndexType::MULTI>>(vectors,
                                                                   make_distance_function_factory(params.distance_metric(), cell_type),
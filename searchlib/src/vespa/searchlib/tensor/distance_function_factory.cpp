@@ -5,6 +5,7 @@
 #include "mips_distance_transform.h"
 
 using search::attribute::DistanceMetric;
+using vespalib::BFloat16;
 using vespalib::eval::CellType;
 using vespalib::eval::Int8Float;
 
@@ -19,6 +20,7 @@ make_distance_function_factory(DistanceMetric variant, CellType cell_type)
                 case CellType::DOUBLE: return std::make_unique<AngularDistanceFunctionFactory<double>>(true);
                 case CellType::INT8:   return std::make_unique<AngularDistanceFunctionFactory<Int8Float>>(true);
                 case CellType::FLOAT:  return std::make_unique<AngularDistanceFunctionFactory<float>>(true);
+                case CellType::BFLOAT16: return std::make_unique<AngularDistanceFunctionFactory<BFloat16>>(true);
                 default:               return std::make_unique<AngularDistanceFunctionFactory<float>>();
             }
         case DistanceMetric::Euclidean:
@@ -26,6 +28,7 @@ make_distance_function_factory(DistanceMetric variant, CellType cell_type)
                 case CellType::DOUBLE:   return std::make_unique<EuclideanDistanceFunctionFactory<double>>(true);
                 case CellType::INT8:     return std::make_unique<EuclideanDistanceFunctionFactory<Int8Float>>(true);
                 case CellType::FLOAT:    return std::make_unique<EuclideanDistanceFunctionFactory<float>>(true);
+                case CellType::BFLOAT16: return std::make_unique<EuclideanDistanceFunctionFactory<BFloat16>>(true);
                 default:                 return std::make_unique<EuclideanDistanceFunctionFactory<float>>();
             }
         case DistanceMetric::InnerProduct:
@@ -34,6 +37,7 @@ make_distance_function_factory(DistanceMetric variant, CellType cell_type)
                 case CellType::DOUBLE:   return std::make_unique<PrenormalizedAngularDistanceFunctionFactory<double>>(true);
                 case CellType::INT8:     return std::make_unique<PrenormalizedAngularDistanceFunctionFactory<Int8Float>>(true);
                 case CellType::FLOAT:    return std::make_unique<PrenormalizedAngularDistanceFunctionFactory<float>>(true);
+                case CellType::BFLOAT16: return std::make_unique<PrenormalizedAngularDistanceFunctionFactory<BFloat16>>(true);
                 default:                 return std::make_unique<PrenormalizedAngularDistanceFunctionFactory<float>>();
             }
         case DistanceMetric::Dotproduct:
@@ -41,6 +45,7 @@ make_distance_function_factory(DistanceMetric variant, CellType cell_type)
                 case CellType::DOUBLE: return std::make_unique<MipsDistanceFunctionFactory<double>>(true);
                 case CellType::INT8:   return std::make_unique<MipsDistanceFunctionFactory<Int8Float>>(true);
                 case CellType::FLOAT:  return std::make_unique<MipsDistanceFunctionFactory<float>>(true);
+                case CellType::BFLOAT16: return std::make_unique<MipsDistanceFunctionFactory<BFloat16>>(true);
                 default:               return std::make_unique<MipsDistanceFunctionFactory<float>>();
             }
         case DistanceMetric::GeoDegrees:
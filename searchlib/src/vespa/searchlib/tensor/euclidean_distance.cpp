@@ -11,6 +11,8 @@ using vespalib::eval::TypedCells;
 
 namespace search::tensor {
 
+using vespalib::BFloat16;
+using vespalib::eval::CellType;
 using vespalib::eval::Int8Float;
 
 template <typename VectorStoreType>
@@ -51,6 +53,7 @@ template class BoundEuclideanDistance<TemporaryVectorStore<double>>;
 template class BoundEuclideanDistance<ReferenceVectorStore<Int8Float>>;
 template class BoundEuclideanDistance<ReferenceVectorStore<float>>;
 template class BoundEuclideanDistance<ReferenceVectorStore<double>>;
+template class BoundEuclideanDistance<ReferenceVectorStore<BFloat16>>;
 
 template <typename FloatType>
 BoundDistanceFunction::UP
@@ -71,8 +74,35 @@ EuclideanDistanceFunctionFactory<FloatType>::for_insertion_vector(TypedCells lhs
     }
 }
 
+/*
+ * Bfloat16 cells are used directly when both vectors are bfloat16, otherwise
+ * they are converted to float as before.
+ */
+template <>
+BoundDistanceFunction::UP
+EuclideanDistanceFunctionFactory<BFloat16>::for_query_vector(TypedCells lhs) const {
+    if (_reference_insertion_vector && lhs.type == CellType::BFLOAT16) {
+        using DFT = BoundEuclideanDistance<ReferenceVectorStore<BFloat16>>;
+        return std::make_unique<DFT>(lhs);
+    }
+    using DFT = BoundEuclideanDistance<TemporaryVectorStore<float>>;
+    return std::make_unique<DFT>(lhs);
+}
+
+template <>
+BoundDistanceFunction::UP
+EuclideanDistanceFunctionFactory<BFloat16>::for_insertion_vector(TypedCells lhs) const {
+    if (_reference_insertion_vector) {
+        using DFT = BoundEuclideanDistance<ReferenceVectorStore<BFloat16>>;
+        return std::make_unique<DFT>(lhs);
+    }
+    using DFT = BoundEuclideanDistance<TemporaryVectorStore<float>>;
+    return std::make_unique<DFT>(lhs);
+}
+
 template class EuclideanDistanceFunctionFactory<Int8Float>;
 template class EuclideanDistanceFunctionFactory<float>;
 template class EuclideanDistanceFunctionFactory<double>;
+template class EuclideanDistanceFunctionFactory<BFloat16>;
 
 }
@@ -21,6 +21,8 @@
 #include <vespa/vespalib/util/memory_allocator.h>
 #include <vespa/vespalib/util/size_literals.h>
 #include <vespa/vespalib/util/time.h>
+#include <functional>
+#include <optional>
 #include <vespa/log/log.h>
 
 LOG_SETUP(".searchlib.tensor.hnsw_index");
@@ -86,6 +88,28 @@ bool operator< (const PairDist &a, const PairDist &b) {
     return (a.distance < b.distance);
 }
 
+/*
+ * Quantized vectors are not saved with the graph, they are rebuilt
+ * from the original vectors when the graph has been loaded.
+ */
+class QuantizingLoader : public NearestNeighborIndexLoader {
+    std::unique_ptr<NearestNeighborIndexLoader> _loader;
+    std::function<void()> _on_complete;
+public:
+    QuantizingLoader(std::unique_ptr<NearestNeighborIndexLoader> loader, std::function<void()> on_complete)
+        : _loader(std::move(loader)),
+          _on_complete(std::move(on_complete))
+    {
+    }
+    bool load_next() override {
+        if (_loader->load_next()) {
+            return true;
+        }
+        _on_complete();
+        return false;
+    }
+};
+
 template <HnswIndexType type>
 class GlobalFilterWrapper;
 
@@ -316,6 +340,86 @@ HnswIndex<type>::remove_link_to(uint32_t remove_from, uint32_t remove_id, uint32
 
 namespace {
 
+/*
+ * Neighbors of a node collected during search, with their vectors.
+ * Vector memory is prefetched when a neighbor is added and all
+ * distances are calculated in one batch afterwards, thus memory
+ * latency for the vectors overlaps instead of adding up.
+ *
+ * When quantized vectors are given, these are used instead of the
+ * original vectors. All neighbors in the batch are dequantized into
+ * the scratch buffer of the search before the distances are calculated
+ * in one batch.
+ */
+class NeighborBatch {
+    QuantizedVectorReader* _quantized_vectors;
+    std::vector<HnswCandidate> _candidates;
+    std::vector<vespalib::eval::TypedCells> _cells;
+    std::vector<double> _distances;
+
+    static void prefetch(vespalib::eval::TypedCells cells) noexcept {
+        constexpr size_t cache_line_size = 64;
+        // The hardware prefetcher takes over when the calculation streams through the vector
+        constexpr size_t max_prefetch_bytes = 1_Ki;
+        auto p = static_cast<const char *>(cells.data);
+        size_t bytes = std::min(vespalib::eval::CellTypeUtils::mem_size(cells.type, cells.size), max_prefetch_bytes);
+        for (size_t offset = 0; offset < bytes; offset += cache_line_size) {
+            __builtin_prefetch(p + offset);
+        }
+    }
+    void dequantize() {
+        _quantized_vectors->reserve(_candidates.size());
+        size_t kept = 0;
+        for (size_t i = 0; i < _candidates.size(); ++i) {
+            auto cells = _quantized_vectors->dequantize(_candidates[i].nodeid, kept);
+            if (cells.non_existing_attribute_value()) [[unlikely]] {
+                // Node removed by write thread, the neighbor is never used.
+                continue;
+            }
+            _candidates[kept++] = _candidates[i];
+            _cells.push_back(cells);
+        }
+        _candidates.erase(_candidates.begin() + kept, _candidates.end());
+    }
+public:
+    explicit NeighborBatch(QuantizedVectorReader* quantized_vectors)
+        : _quantized_vectors(quantized_vectors)
+    {
+        _candidates.reserve(max_link_array_size);
+        _cells.reserve(max_link_array_size);
+        _distances.reserve(max_link_array_size);
+    }
+    bool quantized() const noexcept { return _quantized_vectors != nullptr; }
+    void clear() noexcept {
+        _candidates.clear();
+        _cells.clear();
+    }
+    void add_quantized(uint32_t nodeid, uint32_t docid, EntryRef levels_ref) {
+        _quantized_vectors->prefetch(nodeid);
+        _candidates.emplace_back(nodeid, docid, levels_ref, 0.0);
+    }
+    void add(uint32_t nodeid, uint32_t docid, EntryRef levels_ref, vespalib::eval::TypedCells cells) {
+        if (cells.non_existing_attribute_value()) [[unlikely]] {
+            // Tensor removed by write thread, infinite distance means that the neighbor is never used.
+            return;
+        }
+        prefetch(cells);
+        _candidates.emplace_back(nodeid, docid, levels_ref, 0.0);
+        _cells.push_back(cells);
+    }
+    const std::vector<HnswCandidate>& calc_distances(const BoundDistanceFunction &df) {
+        if (quantized() && !_candidates.empty()) {
+            dequantize();
+        }
+        _distances.resize(_cells.size());
+        df.calc_batch(_cells, _distances);
+        for (size_t i = 0; i < _candidates.size(); ++i) {
+            _candidates[i].distance = _distances[i];
+        }
+        return _candidates;
+    }
+};
+
 double
 calc_distance_helper(const BoundDistanceFunction &df, vespalib::eval::TypedCells rhs)
 {
@@ -341,10 +445,13 @@ HnswIndex<type>::calc_distance(const BoundDistanceFunction &df, uint32_t rhs_nod
 
 template <HnswIndexType type>
 double
-HnswIndex<type>::calc_distance(const BoundDistanceFunction &df, uint32_t rhs_docid, uint32_t rhs_subspace) const
+HnswIndex<type>::calc_distance(const BoundDistanceFunction &df, uint32_t rhs_nodeid, QuantizedVectorReader* quantized_vectors) const
 {
-    auto rhs = get_vector(rhs_docid, rhs_subspace);
-    return calc_distance_helper(df, rhs);
+    if (quantized_vectors == nullptr) {
+        return calc_distance(df, rhs_nodeid);
+    }
+    quantized_vectors->reserve(1);
+    return calc_distance_helper(df, quantized_vectors->dequantize(rhs_nodeid, 0));
 }
 
 template <HnswIndexType type>
@@ -373,22 +480,31 @@ HnswIndex<type>::estimate_visited_nodes(uint32_t level, uint32_t nodeid_limit, u
 
 template <HnswIndexType type>
 HnswCandidate
-HnswIndex<type>::find_nearest_in_layer(const BoundDistanceFunction &df, const HnswCandidate& entry_point, uint32_t level) const
+HnswIndex<type>::find_nearest_in_layer(const BoundDistanceFunction &df, const HnswCandidate& entry_point, uint32_t level,
+                                       QuantizedVectorReader* quantized_vectors) const
 {
     HnswCandidate nearest = entry_point;
+    NeighborBatch batch(quantized_vectors);
     bool keep_searching = true;
     while (keep_searching) {
         keep_searching = false;
+        batch.clear();
         for (uint32_t neighbor_nodeid : _graph.get_link_array(nearest.levels_ref, level)) {
             auto& neighbor_node = _graph.acquire_node(neighbor_nodeid);
             auto neighbor_ref = neighbor_node.levels_ref().load_acquire();
             uint32_t neighbor_docid = acquire_docid(neighbor_node, neighbor_nodeid);
+            if (batch.quantized()) {
+                batch.add_quantized(neighbor_nodeid, neighbor_docid, neighbor_ref);
+                continue;
+            }
             uint32_t neighbor_subspace = neighbor_node.acquire_subspace();
-            double dist = calc_distance(df, neighbor_docid, neighbor_subspace);
-            if (_graph.still_valid(neighbor_nodeid, neighbor_ref)
-                && dist < nearest.distance)
+            batch.add(neighbor_nodeid, neighbor_docid, neighbor_ref, get_vector(neighbor_docid, neighbor_subspace));
+        }
+        for (const auto& neighbor : batch.calc_distances(df)) {
+            if (_graph.still_valid(neighbor.nodeid, neighbor.levels_ref)
+                && neighbor.distance < nearest.distance)
             {
-                nearest = HnswCandidate(neighbor_nodeid, neighbor_docid, neighbor_ref, dist);
+                nearest = neighbor;
                 keep_searching = true;
             }
         }
@@ -402,7 +518,7 @@ void
 HnswIndex<type>::search_layer_helper(const BoundDistanceFunction &df, uint32_t neighbors_to_find,
                                      BestNeighbors& best_neighbors, uint32_t level, const GlobalFilter *filter,
                                      uint32_t nodeid_limit, const vespalib::Doom* const doom,
-                                     uint32_t estimated_visited_nodes) const
+                                     uint32_t estimated_visited_nodes, QuantizedVectorReader* quantized_vectors) const
 {
     NearestPriQ candidates;
     GlobalFilterWrapper<type> filter_wrapper(filter);
@@ -426,6 +542,7 @@ HnswIndex<type>::search_layer_helper(const BoundDistanceFunction &df, uint32_t n
         }
     }
     double limit_dist = std::numeric_limits<double>::max();
+    NeighborBatch batch(quantized_vectors);
 
     while (!candidates.empty()) {
         auto cand = candidates.top();
@@ -433,6 +550,7 @@ HnswIndex<type>::search_layer_helper(const BoundDistanceFunction &df, uint32_t n
             break;
         }
         candidates.pop();
+        batch.clear();
         for (uint32_t neighbor_nodeid : _graph.get_link_array(cand.levels_ref, level)) {
             if (neighbor_nodeid >= nodeid_limit) {
                 continue;
@@ -445,12 +563,19 @@ HnswIndex<type>::search_layer_helper(const BoundDistanceFunction &df, uint32_t n
                 continue;
             }
             uint32_t neighbor_docid = acquire_docid(neighbor_node, neighbor_nodeid);
+            if (batch.quantized()) {
+                batch.add_quantized(neighbor_nodeid, neighbor_docid, neighbor_ref);
+                continue;
+            }
             uint32_t neighbor_subspace = neighbor_node.acquire_subspace();
-            double dist_to_input = calc_distance(df, neighbor_docid, neighbor_subspace);
+            batch.add(neighbor_nodeid, neighbor_docid, neighbor_ref, get_vector(neighbor_docid, neighbor_subspace));
+        }
+        for (const auto& neighbor : batch.calc_distances(df)) {
+            double dist_to_input = neighbor.distance;
             if (dist_to_input < limit_dist) {
-                candidates.emplace(neighbor_nodeid, neighbor_ref, dist_to_input);
-                if (filter_wrapper.check(neighbor_docid)) {
-                    best_neighbors.emplace(neighbor_nodeid, neighbor_docid, neighbor_ref, dist_to_input);
+                candidates.emplace(neighbor.nodeid, neighbor.levels_ref, dist_to_input);
+                if (filter_wrapper.check(neighbor.docid)) {
+                    best_neighbors.emplace(neighbor.nodeid, neighbor.docid, neighbor.levels_ref, dist_to_input);
                     while (best_neighbors.size() > neighbors_to_find) {
                         best_neighbors.pop();
                         limit_dist = best_neighbors.top().distance;
@@ -468,14 +593,17 @@ template <HnswIndexType type>
 template <class BestNeighbors>
 void
 HnswIndex<type>::search_layer(const BoundDistanceFunction &df, uint32_t neighbors_to_find, BestNeighbors& best_neighbors,
-                              uint32_t level, const vespalib::Doom* const doom, const GlobalFilter *filter) const
+                              uint32_t level, const vespalib::Doom* const doom, const GlobalFilter *filter,
+                              QuantizedVectorReader* quantized_vectors) const
 {
     uint32_t nodeid_limit = _graph.nodes_size.load(std::memory_order_acquire);
     uint32_t estimated_visited_nodes = estimate_visited_nodes(level, nodeid_limit, neighbors_to_find, filter);
     if (estimated_visited_nodes >= nodeid_limit / 128) {
-        search_layer_helper<BitVectorVisitedTracker>(df, neighbors_to_find, best_neighbors, level, filter, nodeid_limit, doom, estimated_visited_nodes);
+        search_layer_helper<BitVectorVisitedTracker>(df, neighbors_to_find, best_neighbors, level, filter, nodeid_limit, doom,
+                                                     estimated_visited_nodes, quantized_vectors);
     } else {
-        search_layer_helper<HashSetVisitedTracker>(df, neighbors_to_find, best_neighbors, level, filter, nodeid_limit, doom, estimated_visited_nodes);
+        search_layer_helper<HashSetVisitedTracker>(df, neighbors_to_find, best_neighbors, level, filter, nodeid_limit, doom,
+                                                   estimated_visited_nodes, quantized_vectors);
     }
 }
 
@@ -487,7 +615,8 @@ HnswIndex<type>::HnswIndex(const DocVectorAccess& vectors, DistanceFunctionFacto
       _distance_ff(std::move(distance_ff)),
       _level_generator(std::move(level_generator)),
       _id_mapping(),
-      _cfg(cfg)
+      _cfg(cfg),
+      _quantized_vectors(cfg.quantize_vectors() ? std::make_unique<QuantizedVectorStore>() : nullptr)
 {
     assert(_distance_ff);
 }
@@ -549,7 +678,7 @@ HnswIndex<type>::internal_prepare_add_node(PreparedAddDoc& op, TypedCells input_
     // TODO: check if entry nodeid/levels_ref is still valid here
     HnswCandidate entry_point(entry.nodeid, entry_docid, entry.levels_ref, entry_dist);
     while (search_level > node_max_level) {
-        entry_point = find_nearest_in_layer(*df, entry_point, search_level);
+        entry_point = find_nearest_in_layer(*df, entry_point, search_level, nullptr);
         --search_level;
     }
 
@@ -614,6 +743,10 @@ void
 HnswIndex<type>::internal_complete_add_node(uint32_t nodeid, uint32_t docid, uint32_t subspace, PreparedAddNode &prepared_node)
 {
     int32_t num_levels = prepared_node.connections.size();
+    if (_quantized_vectors) {
+        // Readers must find the quantized vector when the node is reachable from the graph.
+        _quantized_vectors->set(nodeid, get_vector(docid, subspace));
+    }
     auto levels_ref = _graph.make_node(nodeid, docid, subspace, num_levels);
     for (int level = 0; level < num_levels; ++level) {
         auto neighbors = filter_valid_nodeids(level, prepared_node.connections[level], nodeid);
@@ -713,6 +846,9 @@ HnswIndex<type>::remove_node(uint32_t nodeid)
         _graph.set_entry_node(entry);
     }
     _graph.remove_node(nodeid);
+    if (_quantized_vectors) {
+        _quantized_vectors->remove(nodeid);
+    }
 }
 
 template <HnswIndexType type>
@@ -736,6 +872,9 @@ HnswIndex<type>::assign_generation(generation_t current_gen)
     _graph.levels_store.assign_generation(current_gen);
     _graph.links_store.assign_generation(current_gen);
     _id_mapping.assign_generation(current_gen);
+    if (_quantized_vectors) {
+        _quantized_vectors->assign_generation(current_gen);
+    }
 }
 
 template <HnswIndexType type>
@@ -746,6 +885,9 @@ HnswIndex<type>::reclaim_memory(generation_t oldest_used_gen)
     _graph.levels_store.reclaim_memory(oldest_used_gen);
     _graph.links_store.reclaim_memory(oldest_used_gen);
     _id_mapping.reclaim_memory(oldest_used_gen);
+    if (_quantized_vectors) {
+        _quantized_vectors->reclaim_memory(oldest_used_gen);
+    }
 }
 
 template <HnswIndexType type>
@@ -798,6 +940,10 @@ HnswIndex<type>::consider_compact(const CompactionStrategy& compaction_strategy)
         _id_mapping.compact_worst(compaction_strategy);
         result = true;
     }
+    if (_quantized_vectors && _quantized_vectors->consider_compact()) {
+        _quantized_vectors->compact_worst(compaction_strategy);
+        result = true;
+    }
     return result;
 }
 
@@ -810,6 +956,9 @@ HnswIndex<type>::update_stat(const CompactionStrategy& compaction_strategy)
     result.merge(_graph.levels_store.update_stat(compaction_strategy));
     result.merge(_graph.links_store.update_stat(compaction_strategy));
     result.merge(_id_mapping.update_stat(compaction_strategy));
+    if (_quantized_vectors) {
+        result.merge(_quantized_vectors->update_stat(compaction_strategy));
+    }
     return result;
 }
 
@@ -822,6 +971,9 @@ HnswIndex<type>::memory_usage() const
     result.merge(_graph.levels_store.getMemoryUsage());
     result.merge(_graph.links_store.getMemoryUsage());
     result.merge(_id_mapping.memory_usage());
+    if (_quantized_vectors) {
+        result.merge(_quantized_vectors->memory_usage());
+    }
     return result;
 }
 
@@ -846,6 +998,9 @@ HnswIndex<type>::get_state(const vespalib::slime::Inserter& inserter) const
     StateExplorerUtils::memory_usage_to_slime(_graph.nodes.getMemoryUsage(), memUsageObj.setObject("nodes"));
     StateExplorerUtils::memory_usage_to_slime(_graph.levels_store.getMemoryUsage(), memUsageObj.setObject("levels"));
     StateExplorerUtils::memory_usage_to_slime(_graph.links_store.getMemoryUsage(), memUsageObj.setObject("links"));
+    if (_quantized_vectors) {
+        StateExplorerUtils::memory_usage_to_slime(_quantized_vectors->memory_usage(), memUsageObj.setObject("quantized_vectors"));
+    }
     object.setLong("nodeid_limit", _graph.size());
     object.setLong("nodes", _graph.get_active_nodes());
     auto& histogram_array = object.setArray("level_histogram");
@@ -875,6 +1030,7 @@ HnswIndex<type>::get_state(const vespalib::slime::Inserter& inserter) const
     cfgObj.setLong("max_links_on_inserts", _cfg.max_links_on_inserts());
     cfgObj.setLong("neighbors_to_explore_at_construction",
                    _cfg.neighbors_to_explore_at_construction());
+    cfgObj.setBool("quantize_vectors", _cfg.quantize_vectors());
 }
 
 template <HnswIndexType type>
@@ -908,7 +1064,11 @@ HnswIndex<type>::make_loader(FastOS_FileInterface& file, const vespalib::Generic
     load_mips_max_distance(header, distance_function_factory());
     using ReaderType = FileReader<uint32_t>;
     using LoaderType = HnswIndexLoader<ReaderType, type>;
-    return std::make_unique<LoaderType>(_graph, _id_mapping, std::make_unique<ReaderType>(&file));
+    auto loader = std::make_unique<LoaderType>(_graph, _id_mapping, std::make_unique<ReaderType>(&file));
+    if (_quantized_vectors) {
+        return std::make_unique<QuantizingLoader>(std::move(loader), [this]() { quantize_loaded_vectors(); });
+    }
+    return loader;
 }
 
 struct NeighborsByDocId {
@@ -957,19 +1117,43 @@ HnswIndex<type>::top_k_candidates(const BoundDistanceFunction &df, uint32_t k, c
         return best_neighbors;
     }
     int search_level = entry.level;
-    double entry_dist = calc_distance(df, entry.nodeid);
+    // Scratch buffer for dequantized vectors, reused for all distance calculations in this search
+    std::optional<QuantizedVectorReader> quantized_reader;
+    if (_quantized_vectors) {
+        quantized_reader.emplace(*_quantized_vectors);
+    }
+    QuantizedVectorReader* quantized_vectors = quantized_reader ? &quantized_reader.value() : nullptr;
+    double entry_dist = calc_distance(df, entry.nodeid, quantized_vectors);
     uint32_t entry_docid = get_docid(entry.nodeid);
     // TODO: check if entry docid/levels_ref is still valid here
     HnswCandidate entry_point(entry.nodeid, entry_docid, entry.levels_ref, entry_dist);
     while (search_level > 0) {
-        entry_point = find_nearest_in_layer(df, entry_point, search_level);
+        entry_point = find_nearest_in_layer(df, entry_point, search_level, quantized_vectors);
         --search_level;
     }
     best_neighbors.push(entry_point);
-    search_layer(df, k, best_neighbors, 0, &doom, filter);
+    search_layer(df, k, best_neighbors, 0, &doom, filter, quantized_vectors);
+    if (quantized_vectors != nullptr) {
+        return rerank_candidates(df, best_neighbors);
+    }
     return best_neighbors;
 }
 
+template <HnswIndexType type>
+typename HnswIndex<type>::SearchBestNeighbors
+HnswIndex<type>::rerank_candidates(const BoundDistanceFunction &df, const SearchBestNeighbors& candidates) const
+{
+    SearchBestNeighbors result;
+    for (const auto& candidate : candidates.peek()) {
+        auto vector = get_vector(candidate.nodeid);
+        if (vector.non_existing_attribute_value()) [[unlikely]] {
+            continue;
+        }
+        result.emplace(candidate.nodeid, candidate.docid, candidate.levels_ref, df.calc(vector));
+    }
+    return result;
+}
+
 template <HnswIndexType type>
 HnswTestNode
 HnswIndex<type>::get_node(uint32_t nodeid) const
@@ -995,6 +1179,9 @@ HnswIndex<type>::set_node(uint32_t nodeid, const HnswTestNode &node)
 {
     size_t num_levels = node.size();
     assert(num_levels > 0);
+    if (_quantized_vectors) {
+        _quantized_vectors->set(nodeid, get_vector(nodeid, 0));
+    }
     auto levels_ref = _graph.make_node(nodeid, nodeid, 0, num_levels);
     for (size_t level = 0; level < num_levels; ++level) {
         connect_new_node(nodeid, node.level(level), level);
@@ -1125,6 +1312,18 @@ HnswIndex<type>::check_consistency(uint32_t docid_limit) const noexcept
     return inconsistencies;
 }
 
+template <HnswIndexType type>
+void
+HnswIndex<type>::quantize_loaded_vectors()
+{
+    uint32_t nodeid_limit = _graph.size();
+    for (uint32_t nodeid = 1; nodeid < nodeid_limit; ++nodeid) {
+        if (_graph.get_levels_ref(nodeid).valid()) {
+            _quantized_vectors->set(nodeid, get_vector(nodeid));
+        }
+    }
+}
+
 template class HnswIndex<HnswIndexType::SINGLE>;
 template class HnswIndex<HnswIndexType::MULTI>;
 
@@ -13,6 +13,7 @@
 #include "hnsw_single_best_neighbors.h"
 #include "hnsw_test_node.h"
 #include "nearest_neighbor_index.h"
+#include "quantized_vector_store.h"
 #include "random_level_generator.h"
 #include "hnsw_graph.h"
 #include "vector_bundle.h"
@@ -120,6 +121,7 @@ protected:
     RandomLevelGenerator::UP _level_generator;
     IdMapping _id_mapping; // mapping from docid to nodeid vector
     HnswIndexConfig _cfg;
+    std::unique_ptr<QuantizedVectorStore> _quantized_vectors;
 
     uint32_t max_links_for_level(uint32_t level) const;
     void add_link_to(uint32_t nodeid, uint32_t level, const LinkArrayRef& old_links, uint32_t new_link) {
@@ -165,20 +167,31 @@ protected:
     }
 
     double calc_distance(const BoundDistanceFunction &df, uint32_t rhs_nodeid) const;
-    double calc_distance(const BoundDistanceFunction &df, uint32_t rhs_docid, uint32_t rhs_subspace) const;
+    double calc_distance(const BoundDistanceFunction &df, uint32_t rhs_nodeid, QuantizedVectorReader* quantized_vectors) const;
     uint32_t estimate_visited_nodes(uint32_t level, uint32_t nodeid_limit, uint32_t neighbors_to_find, const GlobalFilter* filter) const;
 
     /**
      * Performs a greedy search in the given layer to find the candidate that is nearest the input vector.
      */
-    HnswCandidate find_nearest_in_layer(const BoundDistanceFunction &df, const HnswCandidate& entry_point, uint32_t level) const __attribute__((noinline));
+    HnswCandidate find_nearest_in_layer(const BoundDistanceFunction &df, const HnswCandidate& entry_point, uint32_t level,
+                                        QuantizedVectorReader* quantized_vectors) const __attribute__((noinline));
     template <class VisitedTracker, class BestNeighbors>
     void search_layer_helper(const BoundDistanceFunction &df, uint32_t neighbors_to_find, BestNeighbors& best_neighbors,
                              uint32_t level, const GlobalFilter *filter, uint32_t nodeid_limit,
-                             const vespalib::Doom* const doom, uint32_t estimated_visited_nodes) const __attribute__((noinline));
+                             const vespalib::Doom* const doom, uint32_t estimated_visited_nodes,
+                             QuantizedVectorReader* quantized_vectors) const __attribute__((noinline));
+    /**
+     * Searches the given layer for the nodes nearest the input vector.
+     * Distances are calculated using the quantized vectors if given, otherwise the original vectors.
+     */
     template <class BestNeighbors>
     void search_layer(const BoundDistanceFunction &df, uint32_t neighbors_to_find, BestNeighbors& best_neighbors,
-                      uint32_t level, const vespalib::Doom* const doom, const GlobalFilter *filter = nullptr) const;
+                      uint32_t level, const vespalib::Doom* const doom, const GlobalFilter *filter = nullptr,
+                      QuantizedVectorReader* quantized_vectors = nullptr) const;
+    /**
+     * Recalculates the distances to the given candidates using the original vectors.
+     */
+    SearchBestNeighbors rerank_candidates(const BoundDistanceFunction &df, const SearchBestNeighbors& candidates) const;
     std::vector<Neighbor> top_k_by_docid(uint32_t k, const BoundDistanceFunction &df, const GlobalFilter *filter,
                                          uint32_t explore_k, const vespalib::Doom& doom, double distance_threshold) const;
 
@@ -191,6 +204,7 @@ protected:
 
     // Called from writer only.
     uint32_t get_subspaces(uint32_t docid) const noexcept;
+    void quantize_loaded_vectors();
 public:
     HnswIndex(const DocVectorAccess& vectors, DistanceFunctionFactory::UP distance_ff,
               RandomLevelGenerator::UP level_generator, const HnswIndexConfig& cfg);
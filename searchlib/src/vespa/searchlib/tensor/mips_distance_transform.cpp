@@ -6,6 +6,8 @@
 #include <cmath>
 #include <variant>
 
+using vespalib::BFloat16;
+using vespalib::eval::CellType;
 using vespalib::eval::Int8Float;
 
 namespace search::tensor {
@@ -89,8 +91,27 @@ MipsDistanceFunctionFactory<FloatType>::for_insertion_vector(TypedCells lhs) con
     }
 };
 
+template<>
+BoundDistanceFunction::UP
+MipsDistanceFunctionFactory<BFloat16>::for_query_vector(TypedCells lhs) const {
+    if (_reference_insertion_vector && lhs.type == CellType::BFLOAT16) {
+        return std::make_unique<BoundMipsDistanceFunction<ReferenceVectorStore<BFloat16>, false>>(lhs, *_sq_norm_store);
+    }
+    return std::make_unique<BoundMipsDistanceFunction<TemporaryVectorStore<float>, false>>(lhs, *_sq_norm_store);
+}
+
+template<>
+BoundDistanceFunction::UP
+MipsDistanceFunctionFactory<BFloat16>::for_insertion_vector(TypedCells lhs) const {
+    if (_reference_insertion_vector) {
+        return std::make_unique<BoundMipsDistanceFunction<ReferenceVectorStore<BFloat16>, true>>(lhs, *_sq_norm_store);
+    }
+    return std::make_unique<BoundMipsDistanceFunction<TemporaryVectorStore<float>, true>>(lhs, *_sq_norm_store);
+}
+
 template class MipsDistanceFunctionFactory<Int8Float>;
 template class MipsDistanceFunctionFactory<float>;
 template class MipsDistanceFunctionFactory<double>;
+template class MipsDistanceFunctionFactory<BFloat16>;
 
 }
@@ -4,6 +4,8 @@
 #include "temporary_vector_store.h"
 #include <vespa/vespalib/hwaccelerated/iaccelerated.h>
 
+using vespalib::BFloat16;
+using vespalib::eval::CellType;
 using vespalib::eval::Int8Float;
 using vespalib::eval::TypifyCellType;
 using vespalib::typify_invoke;
@@ -65,6 +67,7 @@ template class BoundPrenormalizedAngularDistance<TemporaryVectorStore<Int8Float>
 template class BoundPrenormalizedAngularDistance<ReferenceVectorStore<float>>;
 template class BoundPrenormalizedAngularDistance<ReferenceVectorStore<double>>;
 template class BoundPrenormalizedAngularDistance<ReferenceVectorStore<Int8Float>>;
+template class BoundPrenormalizedAngularDistance<ReferenceVectorStore<BFloat16>>;
 
 template <typename FloatType>
 BoundDistanceFunction::UP
@@ -85,8 +88,31 @@ PrenormalizedAngularDistanceFunctionFactory<FloatType>::for_insertion_vector(Typ
     }
 }
 
+template <>
+BoundDistanceFunction::UP
+PrenormalizedAngularDistanceFunctionFactory<BFloat16>::for_query_vector(TypedCells lhs) const {
+    if (_reference_insertion_vector && lhs.type == CellType::BFLOAT16) {
+        using DFT = BoundPrenormalizedAngularDistance<ReferenceVectorStore<BFloat16>>;
+        return std::make_unique<DFT>(lhs);
+    }
+    using DFT = BoundPrenormalizedAngularDistance<TemporaryVectorStore<float>>;
+    return std::make_unique<DFT>(lhs);
+}
+
+template <>
+BoundDistanceFunction::UP
+PrenormalizedAngularDistanceFunctionFactory<BFloat16>::for_insertion_vector(TypedCells lhs) const {
+    if (_reference_insertion_vector) {
+        using DFT = BoundPrenormalizedAngularDistance<ReferenceVectorStore<BFloat16>>;
+        return std::make_unique<DFT>(lhs);
+    }
+    using DFT = BoundPrenormalizedAngularDistance<TemporaryVectorStore<float>>;
+    return std::make_unique<DFT>(lhs);
+}
+
 template class PrenormalizedAngularDistanceFunctionFactory<float>;
 template class PrenormalizedAngularDistanceFunctionFactory<double>;
 template class PrenormalizedAngularDistanceFunctionFactory<Int8Float>;
+template class PrenormalizedAngularDistanceFunctionFactory<BFloat16>;
 
 }
@@ -0,0 +1,274 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "quantized_vector_store.h"
+#include <vespa/vespalib/datastore/compacting_buffers.h>
+#include <vespa/vespalib/datastore/compaction_strategy.h>
+#include <vespa/vespalib/datastore/datastore.hpp>
+#include <vespa/vespalib/datastore/entry_ref_filter.h>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+
+namespace search::tensor {
+
+using vespalib::datastore::CompactionStrategy;
+using vespalib::eval::CellTypeUtils;
+using vespalib::eval::TypedCells;
+
+namespace {
+
+constexpr float max_code = 127.0f;
+constexpr size_t min_buffer_entries = 1024;
+
+size_t
+cap_max_entries(size_t max_entries, size_t max_buffer_size, size_t entry_size)
+{
+    size_t dynamic_max_entries = (max_buffer_size + (entry_size - 1)) / entry_size;
+    return std::min(max_entries, dynamic_max_entries);
+}
+
+template <typename FloatType>
+float
+max_abs_value(std::span<const FloatType> cells) noexcept
+{
+    float result = 0.0f;
+    for (FloatType cell : cells) {
+        result = std::max(result, std::abs(float(cell)));
+    }
+    return result;
+}
+
+template <typename FloatType>
+void
+quantize(std::span<const FloatType> cells, float inv_scale, int8_t* codes) noexcept
+{
+    for (size_t i = 0; i < cells.size(); ++i) {
+        float code = std::nearbyint(float(cells[i]) * inv_scale);
+        codes[i] = int8_t(std::clamp(code, -max_code, max_code));
+    }
+}
+
+template <typename FloatType>
+TypedCells
+dequantize_helper(const int8_t* codes, uint32_t dims, float scale, std::span<char> buf) noexcept
+{
+    auto* dst = reinterpret_cast<FloatType*>(buf.data());
+    for (uint32_t i = 0; i < dims; ++i) {
+        dst[i] = FloatType(float(codes[i]) * scale);
+    }
+    return TypedCells(std::span<const FloatType>(dst, dims));
+}
+
+}
+
+QuantizedVectorStore::QuantizedVectorStore()
+    : _refs(),
+      _store(),
+      _buffer_type(),
+      _dims(0),
+      _cell_type(CellType::FLOAT),
+      _entry_size(0),
+      _compaction_spec()
+{
+}
+
+QuantizedVectorStore::~QuantizedVectorStore()
+{
+    _store.dropBuffers();
+}
+
+bool
+QuantizedVectorStore::supports(CellType cell_type) noexcept
+{
+    return (cell_type == CellType::DOUBLE || cell_type == CellType::FLOAT || cell_type == CellType::BFLOAT16);
+}
+
+void
+QuantizedVectorStore::init(TypedCells cells)
+{
+    assert(supports(cells.type));
+    _dims = cells.size;
+    _cell_type = cells.type;
+    // Keep the scale of each entry aligned
+    _entry_size = (sizeof(float) + _dims + (alignof(float) - 1)) & ~(alignof(float) - 1);
+    _buffer_type = std::make_unique<vespalib::datastore::BufferType<char>>(_entry_size, min_buffer_entries,
+                                                                             cap_max_entries(RefType::offsetSize(), max_buffer_size, _entry_size));
+    _store.addType(_buffer_type.get());
+    _store.init_primary_buffers();
+    _store.enableFreeLists();
+}
+
+QuantizedVectorStore::EntryRef
+QuantizedVectorStore::store_entry(TypedCells cells)
+{
+    float max_abs = 0.0f;
+    switch (_cell_type) {
+    case CellType::DOUBLE:   max_abs = max_abs_value(cells.unsafe_typify<double>()); break;
+    case CellType::FLOAT:    max_abs = max_abs_value(cells.unsafe_typify<float>()); break;
+    case CellType::BFLOAT16: max_abs = max_abs_value(cells.unsafe_typify<vespalib::BFloat16>()); break;
+    default: abort();
+    }
+    float scale = max_abs / max_code;
+    float inv_scale = (max_abs > 0.0f) ? (max_code / max_abs) : 0.0f;
+    auto handle = _store.freeListRawAllocator<char>(0u).alloc(1);
+    memcpy(handle.data, &scale, sizeof(float));
+    auto* codes = reinterpret_cast<int8_t*>(handle.data + sizeof(float));
+    switch (_cell_type) {
+    case CellType::DOUBLE:   quantize(cells.unsafe_typify<double>(), inv_scale, codes); break;
+    case CellType::FLOAT:    quantize(cells.unsafe_typify<float>(), inv_scale, codes); break;
+    case CellType::BFLOAT16: quantize(cells.unsafe_typify<vespalib::BFloat16>(), inv_scale, codes); break;
+    default: abort();
+    }
+    memset(handle.data + sizeof(float) + _dims, 0, _entry_size - sizeof(float) - _dims);
+    return handle.ref;
+}
+
+void
+QuantizedVectorStore::set(uint32_t nodeid, TypedCells cells)
+{
+    // Readers look up the entry for every node linked into the graph, thus the node must be covered
+    // by the refs even if no entry is stored for it.
+    _refs.ensure_size(nodeid + 1);
+    if (cells.non_existing_attribute_value()) {
+        remove(nodeid);
+        return;
+    }
+    if (_dims == 0) {
+        init(cells);
+    }
+    assert(cells.size == _dims && cells.type == _cell_type);
+    EntryRef ref = store_entry(cells);
+    EntryRef old_ref = _refs[nodeid].load_relaxed();
+    _refs[nodeid].store_release(ref);
+    if (old_ref.valid()) {
+        _store.hold_entry(old_ref);
+    }
+}
+
+void
+QuantizedVectorStore::remove(uint32_t nodeid)
+{
+    if (nodeid >= _refs.size()) {
+        return;
+    }
+    EntryRef old_ref = _refs[nodeid].load_relaxed();
+    if (old_ref.valid()) {
+        _refs[nodeid].store_release(EntryRef());
+        _store.hold_entry(old_ref);
+    }
+}
+
+size_t
+QuantizedVectorStore::dequantized_size() const noexcept
+{
+    return CellTypeUtils::mem_size(_cell_type, _dims);
+}
+
+void
+QuantizedVectorStore::prefetch(uint32_t nodeid) const noexcept
+{
+    constexpr size_t cache_line_size = 64;
+    EntryRef ref = _refs.acquire_elem_ref(nodeid).load_acquire();
+    if (!ref.valid()) [[unlikely]] {
+        return;
+    }
+    const char* p = get_entry(ref);
+    for (size_t offset = 0; offset < _entry_size; offset += cache_line_size) {
+        __builtin_prefetch(p + offset);
+    }
+}
+
+TypedCells
+QuantizedVectorStore::dequantize(uint32_t nodeid, std::span<char> buf) const noexcept
+{
+    assert(buf.size() >= dequantized_size());
+    EntryRef ref = _refs.acquire_elem_ref(nodeid).load_acquire();
+    if (!ref.valid()) [[unlikely]] {
+        return TypedCells::create_non_existing_attribute_value(buf.data(), _cell_type, _dims);
+    }
+    const char* entry = get_entry(ref);
+    float scale;
+    memcpy(&scale, entry, sizeof(float));
+    auto* codes = reinterpret_cast<const int8_t*>(entry + sizeof(float));
+    switch (_cell_type) {
+    case CellType::DOUBLE:   return dequantize_helper<double>(codes, _dims, scale, buf);
+    case CellType::FLOAT:    return dequantize_helper<float>(codes, _dims, scale, buf);
+    case CellType::BFLOAT16: return dequantize_helper<vespalib::BFloat16>(codes, _dims, scale, buf);
+    default: abort();
+    }
+}
+
+void
+QuantizedVectorStore::assign_generation(generation_t current_gen)
+{
+    // Note: RcuVector transfers hold lists as part of reallocation based on current generation.
+    _refs.setGeneration(current_gen + 1);
+    _store.assign_generation(current_gen);
+}
+
+void
+QuantizedVectorStore::reclaim_memory(generation_t oldest_used_gen)
+{
+    _refs.reclaim_memory(oldest_used_gen);
+    _store.reclaim_memory(oldest_used_gen);
+}
+
+QuantizedVectorStore::EntryRef
+QuantizedVectorStore::move_on_compact(EntryRef ref)
+{
+    auto handle = _store.freeListRawAllocator<char>(0u).alloc(1);
+    memcpy(handle.data, get_entry(ref), _entry_size);
+    return handle.ref;
+}
+
+vespalib::MemoryUsage
+QuantizedVectorStore::update_stat(const CompactionStrategy& compaction_strategy)
+{
+    auto store_memory_usage = _store.getMemoryUsage();
+    _compaction_spec = compaction_strategy.should_compact(store_memory_usage, _store.getAddressSpaceUsage());
+    vespalib::MemoryUsage result = _refs.getMemoryUsage();
+    result.merge(store_memory_usage);
+    return result;
+}
+
+void
+QuantizedVectorStore::compact_worst(const CompactionStrategy& compaction_strategy)
+{
+    auto compacting_buffers = _store.start_compact_worst_buffers(_compaction_spec, compaction_strategy);
+    auto filter = compacting_buffers->make_entry_ref_filter();
+    for (size_t nodeid = 0; nodeid < _refs.size(); ++nodeid) {
+        EntryRef ref = _refs[nodeid].load_relaxed();
+        if (ref.valid() && filter.has(ref)) {
+            _refs[nodeid].store_release(move_on_compact(ref));
+        }
+    }
+    compacting_buffers->finish();
+}
+
+vespalib::MemoryUsage
+QuantizedVectorStore::memory_usage() const
+{
+    vespalib::MemoryUsage result = _refs.getMemoryUsage();
+    result.merge(_store.getMemoryUsage());
+    return result;
+}
+
+QuantizedVectorReader::QuantizedVectorReader(const QuantizedVectorStore& store)
+    : _store(store),
+      _vector_size(store.dequantized_size()),
+      _buf()
+{
+}
+
+QuantizedVectorReader::~QuantizedVectorReader() = default;
+
+void
+QuantizedVectorReader::reserve(size_t num_vectors)
+{
+    if (_buf.size() < num_vectors * _vector_size) {
+        _buf.resize(num_vectors * _vector_size);
+    }
+}
+
+}
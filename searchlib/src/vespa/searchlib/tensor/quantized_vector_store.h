@@ -0,0 +1,122 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include <vespa/eval/eval/typed_cells.h>
+#include <vespa/vespalib/datastore/atomic_entry_ref.h>
+#include <vespa/vespalib/datastore/buffer_type.h>
+#include <vespa/vespalib/datastore/compaction_spec.h>
+#include <vespa/vespalib/datastore/datastore.h>
+#include <vespa/vespalib/util/generationhandler.h>
+#include <vespa/vespalib/util/memoryusage.h>
+#include <vespa/vespalib/util/rcuvector.h>
+#include <vespa/vespalib/util/size_literals.h>
+#include <span>
+#include <vector>
+
+namespace vespalib::datastore { class CompactionStrategy; }
+
+namespace search::tensor {
+
+/**
+ * Compact copies of the vectors in an hnsw index, used when traversing the graph.
+ *
+ * Each vector is scalar quantized to int8 codes with a scale factor per vector
+ * (max absolute cell value / 127). Codes are indexed by nodeid and must be set
+ * by the writer thread before the node is linked into the graph.
+ * Readers dequantize the codes into the cell type of the original vectors,
+ * thus any bound distance function for the original vectors can be used.
+ *
+ * The codes are stored in a data store, one entry per node, so the store grows
+ * buffer by buffer. Entries are freed when nodes are removed, and buffers
+ * with many free entries are compacted.
+ *
+ * The codes are kept in addition to the original vectors. Memory is only saved
+ * when the original vectors are paged, see ConfigConverter.
+ *
+ * Only float, double and bfloat16 cells are supported.
+ */
+class QuantizedVectorStore {
+public:
+    using generation_t = vespalib::GenerationHandler::generation_t;
+    using TypedCells = vespalib::eval::TypedCells;
+    using CellType = vespalib::eval::CellType;
+    using EntryRef = vespalib::datastore::EntryRef;
+    using AtomicEntryRef = vespalib::datastore::AtomicEntryRef;
+    // 4 Ki buffers of 256 MiB each is 1 TiB.
+    using RefType = vespalib::datastore::EntryRefT<20>;
+    using DataStoreType = vespalib::datastore::DataStoreT<RefType>;
+    static constexpr size_t max_buffer_size = 256_Mi;
+private:
+    vespalib::RcuVector<AtomicEntryRef> _refs;
+    DataStoreType                       _store;
+    // Entry layout: float scale followed by the int8 codes, set up when the first vector is added.
+    std::unique_ptr<vespalib::datastore::BufferType<char>> _buffer_type;
+    // Set by the writer thread when the first vector is added, before any node is linked.
+    uint32_t                            _dims;
+    CellType                            _cell_type;
+    uint32_t                            _entry_size;
+    vespalib::datastore::CompactionSpec _compaction_spec;
+
+    void init(TypedCells cells);
+    const char* get_entry(EntryRef ref) const noexcept {
+        return _store.getEntryArray<char>(RefType(ref), _entry_size);
+    }
+    EntryRef store_entry(TypedCells cells);
+    EntryRef move_on_compact(EntryRef ref);
+public:
+    QuantizedVectorStore();
+    ~QuantizedVectorStore();
+
+    static bool supports(CellType cell_type) noexcept;
+
+    // Called from writer only.
+    void set(uint32_t nodeid, TypedCells cells);
+    void remove(uint32_t nodeid);
+
+    uint32_t dims() const noexcept { return _dims; }
+    CellType cell_type() const noexcept { return _cell_type; }
+    // Size of buffer needed by dequantize()
+    size_t dequantized_size() const noexcept;
+
+    void prefetch(uint32_t nodeid) const noexcept;
+    /**
+     * Dequantizes the codes for the given node into the given buffer, returning
+     * cells of the same type as the original vector. If the node has been
+     * removed by the writer thread, the cells are marked as a non-existing
+     * attribute value.
+     */
+    TypedCells dequantize(uint32_t nodeid, std::span<char> buf) const noexcept;
+
+    void assign_generation(generation_t current_gen);
+    void reclaim_memory(generation_t oldest_used_gen);
+    vespalib::MemoryUsage update_stat(const vespalib::datastore::CompactionStrategy& compaction_strategy);
+    bool consider_compact() const noexcept { return _compaction_spec.compact() && !_store.has_held_buffers(); }
+    void compact_worst(const vespalib::datastore::CompactionStrategy& compaction_strategy);
+    vespalib::MemoryUsage memory_usage() const;
+};
+
+/**
+ * Dequantizes vectors from a QuantizedVectorStore for a single search.
+ *
+ * The vectors are dequantized into slots of a scratch buffer that is
+ * reused for the whole search. Cells returned by dequantize() are
+ * valid until the next call to reserve().
+ */
+class QuantizedVectorReader {
+    using TypedCells = vespalib::eval::TypedCells;
+    const QuantizedVectorStore& _store;
+    size_t                      _vector_size;
+    std::vector<char>           _buf;
+public:
+    explicit QuantizedVectorReader(const QuantizedVectorStore& store);
+    ~QuantizedVectorReader();
+    void prefetch(uint32_t nodeid) const noexcept { _store.prefetch(nodeid); }
+    // Makes room for the given number of dequantized vectors.
+    void reserve(size_t num_vectors);
+    TypedCells dequantize(uint32_t nodeid, size_t slot) noexcept {
+        return _store.dequantize(nodeid, std::span<char>(_buf.data() + slot * _vector_size, _vector_size));
+    }
+};
+
+}
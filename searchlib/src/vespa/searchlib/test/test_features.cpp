@@ -42,6 +42,12 @@ ImpureValueBlueprint::createExecutor(const IQueryEnvironment &, vespalib::Stash
 
 struct DocidExecutor : FeatureExecutor {
     void execute(uint32_t docid) override { outputs().set_number(0, docid); }
+    bool supports_execute_block() const override { return true; }
+    void execute_block(std::span<const uint32_t> docids, std::span<feature_t> result) override {
+        for (size_t i = 0; i < docids.size(); ++i) {
+            result[i] = docids[i];
+        }
+    }
 };
 
 bool
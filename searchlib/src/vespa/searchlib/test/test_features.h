@@ -23,7 +23,7 @@ struct ImpureValueBlueprint : Blueprint {
 
 //-----------------------------------------------------------------------------
 
-// "docid" calculates local document id
+// "docid" calculates local document id (also for blocks of documents)
 struct DocidBlueprint : Blueprint {
     DocidBlueprint() : Blueprint("docid") {}
     void visitDumpFeatures(const IIndexEnvironment &, IDumpFeatureVisitor &) const override {}
@@ -40,6 +40,7 @@ createCommitChunk(const DomainConfig &cfg) {
 }
 
 VESPA_THREAD_STACK_TAG(tls_domain_commit);
+VESPA_THREAD_STACK_TAG(tls_domain_sync);
 }
 
 Domain::Domain(const string &domainName, const string & baseDir, vespalib::Executor & executor,
@@ -48,12 +49,16 @@ Domain::Domain(const string &domainName, const string & baseDir, vespalib::Execu
       _currentChunk(createCommitChunk(cfg)),
       _lastSerial(0),
       _singleCommitter(std::make_unique<vespalib::ThreadStackExecutor>(1, CpuUsage::wrap(tls_domain_commit, CpuCategory::WRITE))),
+      _singleSyncer(std::make_unique<vespalib::ThreadStackExecutor>(1, CpuUsage::wrap(tls_domain_sync, CpuCategory::WRITE))),
       _executor(executor),
       _sessionId(1),
       _name(domainName),
       _parts(),
       _partsMutex(),
       _currentChunkMutex(),
+      _pendingSyncMutex(),
+      _pendingSync(),
+      _syncScheduled(false),
       _sessionMutex(),
       _sessions(),
       _maxSessionRunTime(),
@@ -123,6 +128,10 @@ Domain::~Domain() {
     vespalib::Gate gate;
     _singleCommitter->execute(makeLambdaTask([callback=std::make_unique<vespalib::GateCallback>(gate)]() { (void) callback;}));
     gate.await();
+    // All syncs are scheduled by the committer, thus drained after it.
+    vespalib::Gate syncGate;
+    _singleSyncer->execute(makeLambdaTask([callback=std::make_unique<vespalib::GateCallback>(syncGate)]() { (void) callback;}));
+    syncGate.await();
 }
 
 DomainInfo
@@ -377,24 +386,56 @@ Domain::commitChunk(std::unique_ptr<CommitChunk> chunk, const UniqueLock & chunk
         promise.set_value(SerializedChunk(std::move(chunk), encoding, compressionLevel));
     }));
     _singleCommitter->execute( makeLambdaTask([this, future = std::move(future)]() mutable {
-        doCommit(future.get());
+        doCommit(std::make_unique<SerializedChunk>(future.get()));
     }));
 }
 
-
-
 void
-Domain::doCommit(const SerializedChunk & serialized) {
+Domain::doCommit(std::unique_ptr<SerializedChunk> serialized) {
 
-    SerialNumRange range = serialized.range();
+    SerialNumRange range = serialized->range();
     DomainPart::SP dp = optionallyRotateFile(range.from());
-    dp->commit(serialized);
+    dp->commit(*serialized);
+    cleanSessions();
     if (_config.getFSyncOnCommit()) {
-        dp->sync();
+        // Writing the next chunk overlaps with syncing this one.
+        scheduleSync(std::move(serialized));
+        return;
     }
-    cleanSessions();
     LOG(debug, "Releasing %zu acks and %zu entries and %zu bytes.",
-        serialized.getNumCallBacks(), serialized.getNumEntries(), serialized.getData().size());
+        serialized->getNumCallBacks(), serialized->getNumEntries(), serialized->getData().size());
+}
+
+void
+Domain::scheduleSync(std::unique_ptr<SerializedChunk> serialized) {
+    std::lock_guard guard(_pendingSyncMutex);
+    _pendingSync.push_back(std::move(serialized));
+    if ( ! _syncScheduled ) {
+        _syncScheduled = true;
+        _singleSyncer->execute(makeLambdaTask([this]() { syncPending(); }));
+    }
+}
+
+void
+Domain::syncPending() {
+    vespalib::duration window = _config.getGroupCommitWindow();
+    if (window > vespalib::duration::zero()) {
+        // Let more commits arrive so they share the same sync.
+        std::this_thread::sleep_for(window);
+    }
+    SerializedChunkList synced;
+    {
+        std::lock_guard guard(_pendingSyncMutex);
+        synced.swap(_pendingSync);
+        _syncScheduled = false;
+    }
+    // Chunks written to an older part were synced when that part was closed.
+    getActivePart()->sync();
+    size_t numCallBacks = 0;
+    for (const auto & serialized : synced) {
+        numCallBacks += serialized->getNumCallBacks();
+    }
+    LOG(debug, "Releasing %zu acks from %zu chunks after sync.", numCallBacks, synced.size());
 }
 
 bool
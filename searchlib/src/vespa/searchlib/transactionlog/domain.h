@@ -63,7 +63,9 @@ private:
 
     std::unique_ptr<CommitChunk> grabCurrentChunk(const UniqueLock & guard);
     void commitChunk(std::unique_ptr<CommitChunk> chunk, const UniqueLock & chunkOrderGuard);
-    void doCommit(const SerializedChunk & serialized);
+    void doCommit(std::unique_ptr<SerializedChunk> serialized);
+    void scheduleSync(std::unique_ptr<SerializedChunk> serialized);
+    void syncPending();
     SerialNum begin(const UniqueLock & guard) const;
     SerialNum end(const UniqueLock & guard) const;
     size_t byteSize(const UniqueLock & guard) const;
@@ -81,17 +83,23 @@ private:
     using DomainPartList = std::map<SerialNum, DomainPartSP>;
     using DurationSeconds = std::chrono::duration<double>;
     using Executor = vespalib::Executor;
+    using SerializedChunkList = std::vector<std::unique_ptr<SerializedChunk>>;
 
     DomainConfig                 _config;
     std::unique_ptr<CommitChunk> _currentChunk;
     SerialNum                    _lastSerial;
     std::unique_ptr<Executor>    _singleCommitter;
+    std::unique_ptr<Executor>    _singleSyncer;
     Executor                    &_executor;
     std::atomic<int>             _sessionId;
     std::string             _name;
     DomainPartList               _parts;
     mutable std::mutex           _partsMutex;
     std::mutex                   _currentChunkMutex;
+    std::mutex                   _pendingSyncMutex;
+    // Chunks written, but not yet synced. Acks are released when they are synced.
+    SerializedChunkList          _pendingSync;
+    bool                         _syncScheduled;
     mutable std::mutex           _sessionMutex;
     SessionList                  _sessions;
     DurationSeconds              _maxSessionRunTime;
@@ -16,17 +16,20 @@ public:
     DomainConfig & setChunkSizeLimit(size_t v)      { _chunkSizeLimit = v; return *this; }
     DomainConfig & setCompressionLevel(uint8_t v)   { _compressionLevel = v; return *this; }
     DomainConfig & setFSyncOnCommit(bool v)         { _fSyncOnCommit = v; return *this; }
+    DomainConfig & setGroupCommitWindow(duration v) { _groupCommitWindow = v; return *this; }
     Encoding          getEncoding() const { return _encoding; }
     size_t       getPartSizeLimit() const { return _partSizeLimit; }
     size_t      getChunkSizeLimit() const { return _chunkSizeLimit; }
     uint8_t   getCompressionlevel() const { return _compressionLevel; }
     bool         getFSyncOnCommit() const { return _fSyncOnCommit; }
+    duration getGroupCommitWindow() const { return _groupCommitWindow; }
 private:
     Encoding     _encoding;
     uint8_t      _compressionLevel;
     bool         _fSyncOnCommit;
     size_t       _partSizeLimit;
     size_t       _chunkSizeLimit;
+    duration     _groupCommitWindow;
 };
 
 struct PartInfo {
@@ -42,6 +42,16 @@ using document::StructFieldValue;
 
 namespace {
 
+std::string
+make_long(const std::string& base)
+{
+    std::string result;
+    while (result.size() < 2 * DocsumStoreDocument::min_external_field_size) {
+        result += base;
+    }
+    return result;
+}
+
 struct SlimeSummaryTest : testing::Test, IDocsumStore, GetDocsumsStateCallback {
     std::unique_ptr<DynamicDocsumWriter> writer;
     StructDataType  int_pair_type;
@@ -77,8 +87,8 @@ struct SlimeSummaryTest : testing::Test, IDocsumStore, GetDocsumsStateCallback {
         doc->setValue("int64_field", LongFieldValue(8));
         doc->setValue("string_field", StringFieldValue("string"));
         doc->setValue("data_field", RawFieldValue("data"));
-        doc->setValue("longstring_field", StringFieldValue("long_string"));
-        doc->setValue("longdata_field", RawFieldValue("long_data"));
+        doc->setValue("longstring_field", StringFieldValue(make_long("long_string")));
+        doc->setValue("longdata_field", RawFieldValue(make_long("long_data")));
         {
             StructFieldValue int_pair(int_pair_type);
             int_pair.setValue("foo", IntFieldValue(1));
@@ -147,8 +157,8 @@ TEST_F(SlimeSummaryTest, docsum_can_be_written_as_slime)
     EXPECT_EQ(s.get()["int64_field"].asLong(), 8u);
     EXPECT_EQ(s.get()["string_field"].asString().make_string(), std::string("string"));
     EXPECT_EQ(s.get()["data_field"].asData().make_string(), std::string("data"));
-    EXPECT_EQ(s.get()["longstring_field"].asString().make_string(), std::string("long_string"));
-    EXPECT_EQ(s.get()["longdata_field"].asData().make_string(), std::string("long_data"));
+    EXPECT_EQ(s.get()["longstring_field"].asString().make_string(), make_long("long_string"));
+    EXPECT_EQ(s.get()["longdata_field"].asData().make_string(), make_long("long_data"));
     EXPECT_EQ(s.get()["int_pair_field"]["foo"].asLong(), 1u);
     EXPECT_EQ(s.get()["int_pair_field"]["bar"].asLong(), 2u);
 }
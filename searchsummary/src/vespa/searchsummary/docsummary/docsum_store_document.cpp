@@ -6,10 +6,44 @@
 #include <vespa/document/base/exceptions.h>
 #include <vespa/document/datatype/datatype.h>
 #include <vespa/document/fieldvalue/document.h>
+#include <vespa/document/fieldvalue/rawfieldvalue.h>
+#include <vespa/document/fieldvalue/stringfieldvalue.h>
+#include <vespa/vespalib/data/slime/external_memory.h>
 #include <vespa/vespalib/data/slime/inserter.h>
 
+using document::RawFieldValue;
+using document::StringFieldValue;
+using vespalib::Memory;
+using vespalib::slime::ExternalMemory;
+
 namespace search::docsummary {
 
+namespace {
+
+/*
+ * External memory referencing a field value. The field value might
+ * reference the serialized document, thus the document is kept alive
+ * as well.
+ */
+class FieldValueMemory : public ExternalMemory {
+    std::shared_ptr<const document::Document> _document;
+    DocsumStoreFieldValue                     _value;
+    Memory                                    _memory;
+public:
+    FieldValueMemory(std::shared_ptr<const document::Document> document, DocsumStoreFieldValue value, Memory memory) noexcept
+        : _document(std::move(document)),
+          _value(std::move(value)),
+          _memory(memory)
+    {
+    }
+    ~FieldValueMemory() override;
+    Memory get() const override { return _memory; }
+};
+
+FieldValueMemory::~FieldValueMemory() = default;
+
+}
+
 DocsumStoreDocument::DocsumStoreDocument(std::unique_ptr<document::Document> document)
     : _document(std::move(document))
 {
@@ -41,10 +75,32 @@ DocsumStoreDocument::insert_summary_field(const std::string& field_name, vespali
 {
     auto field_value = get_field_value(field_name);
     if (field_value) {
+        if (converter == nullptr && insert_external_field(field_value, inserter)) {
+            return;
+        }
         SlimeFiller::insert_summary_field(*field_value, inserter, converter);
     }
 }
 
+bool
+DocsumStoreDocument::insert_external_field(DocsumStoreFieldValue& field_value, vespalib::slime::Inserter& inserter) const
+{
+    if (field_value->isA(document::FieldValue::Type::STRING)) {
+        Memory memory(static_cast<const StringFieldValue&>(*field_value).getValueRef());
+        if (memory.size >= min_external_field_size) {
+            inserter.insertExternalString(std::make_unique<FieldValueMemory>(_document, std::move(field_value), memory));
+            return true;
+        }
+    } else if (field_value->isA(document::FieldValue::Type::RAW)) {
+        auto buf = static_cast<const RawFieldValue&>(*field_value).getAsRaw();
+        if (buf.second >= min_external_field_size) {
+            inserter.insertData(std::make_unique<FieldValueMemory>(_document, std::move(field_value), Memory(buf.first, buf.second)));
+            return true;
+        }
+    }
+    return false;
+}
+
 void
 DocsumStoreDocument::insert_juniper_field(const std::string& field_name, vespalib::slime::Inserter& inserter, IJuniperConverter& converter) const
 {
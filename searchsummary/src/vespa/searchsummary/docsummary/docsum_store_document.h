@@ -10,11 +10,18 @@ namespace search::docsummary {
 
 /**
  * Class providing access to a document retrieved from an IDocsumStore.
+ *
+ * Large string and raw fields inserted without a converter are not copied
+ * into the docsum. They are added as external memory referencing the field
+ * value, sharing ownership of the document and thus its serialized buffer.
  **/
 class DocsumStoreDocument : public IDocsumStoreDocument
 {
-    std::unique_ptr<document::Document> _document;
+    std::shared_ptr<const document::Document> _document;
+    bool insert_external_field(DocsumStoreFieldValue& field_value, vespalib::slime::Inserter& inserter) const;
 public:
+    // Strings and raw data at least this large are inserted without being copied
+    static constexpr size_t min_external_field_size = 256;
     explicit DocsumStoreDocument(std::unique_ptr<document::Document> document);
     ~DocsumStoreDocument() override;
     DocsumStoreFieldValue get_field_value(const std::string& field_name) const override;
@@ -2,7 +2,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <span>
 
 namespace search::docsummary {
 
@@ -22,6 +24,13 @@ public:
      * Get a docsum specific abstract of the document for the given local document id.
      **/
     virtual std::unique_ptr<const IDocsumStoreDocument> get_document(uint32_t docid) = 0;
+
+    /**
+     * Hint that documents for the given local document ids will be requested soon,
+     * allowing the store to fetch them in one batch. Documents prefetched by an
+     * earlier call that have not been requested yet may be dropped.
+     **/
+    virtual void prefetch(std::span<const uint32_t> docids) { (void) docids; }
 };
 
 }
@@ -2092,4 +2092,41 @@ TEST_F(FileStorHandlerTest, inhibited_operations_are_skipped)
     EXPECT_EQ(30, get_next_message().msg->getPriority());
 }
 
+TEST_F(FileStorHandlerTest, operations_are_dequeued_in_priority_order_when_locks_are_released)
+{
+    std::string docid_a = "id:foo:testdoctype1::a";
+    std::string docid_b = "id:foo:testdoctype1::b";
+    handler->schedule(make_put_command(20, docid_a));
+    {
+        auto locked_a = get_next_message();
+        handler->schedule(make_put_command(30, docid_a));
+        handler->schedule(make_put_command(30, docid_b));
+        handler->schedule(make_put_command(50, docid_a));
+        handler->schedule(make_put_command(40, docid_b));
+        auto locked_b = get_next_message();
+        ASSERT_TRUE(locked_b.msg);
+        EXPECT_EQ(30, locked_b.msg->getPriority());
+        EXPECT_EQ(docid_b, dynamic_cast<api::PutCommand&>(*locked_b.msg).getDocumentId().toString());
+        // Both buckets are locked
+        EXPECT_FALSE(get_next_message().msg);
+    }
+    EXPECT_EQ(30, get_next_message().msg->getPriority());
+    EXPECT_EQ(40, get_next_message().msg->getPriority());
+    EXPECT_EQ(50, get_next_message().msg->getPriority());
+}
+
+TEST_F(FileStorHandlerTest, shared_operations_are_not_blocked_by_queued_exclusive_operations)
+{
+    handler->schedule(make_get_command(20));
+    auto locked_get = get_next_message();
+    ASSERT_TRUE(locked_get.msg);
+    handler->schedule(make_put_command(25));
+    handler->schedule(make_get_command(30));
+    // Put requires an exclusive lock and is inhibited by the shared lock held by the first get.
+    auto second_get = get_next_message();
+    ASSERT_TRUE(second_get.msg);
+    EXPECT_EQ(30, second_get.msg->getPriority());
+    EXPECT_EQ(api::MessageType::GET_ID, second_get.msg->getType().getId());
+}
+
 } // storage
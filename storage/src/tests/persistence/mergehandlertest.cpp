@@ -1413,6 +1413,60 @@ TEST_F(MergeHandlerTest, partially_filled_apply_bucket_diff_reply)
     LOG(debug, "got mergebucket reply");
 }
 
+TEST_F(MergeHandlerTest, local_writes_overlap_with_next_apply_bucket_diff_when_no_local_data_needed)
+{
+    _maxTimestamp = 30000;  // Extend timestamp range to include doc1 and doc2
+    auto doc1 = _env->_testDocMan.createRandomDocumentAtLocation(_location, 1);
+    auto doc2 = _env->_testDocMan.createRandomDocumentAtLocation(_location, 2);
+
+    MergeHandler handler = createHandler();
+    auto cmd = std::make_shared<api::MergeBucketCommand>(_bucket, _nodes, _maxTimestamp);
+    handler.handleMergeBucket(*cmd, createTracker(cmd, _bucket));
+    ASSERT_EQ(1u, messageKeeper()._msgs.size());
+    {
+        auto& cmd2 = dynamic_cast<api::GetBucketDiffCommand&>(*messageKeeper()._msgs[0]);
+        auto reply = std::make_unique<api::GetBucketDiffReply>(cmd2);
+        // doc1 and doc2 are only present on node 1.
+        auto& diff = reply->getDiff();
+        diff.clear();
+        diff.push_back(make_entry(20000, 2u));
+        diff.push_back(make_entry(20100, 2u));
+        handler.handleGetBucketDiffReply(*reply, messageKeeper());
+    }
+    ASSERT_EQ(2u, messageKeeper()._msgs.size());
+    ASSERT_EQ(api::MessageType::APPLYBUCKETDIFF, messageKeeper()._msgs[1]->getType());
+    {
+        auto& cmd3 = dynamic_cast<api::ApplyBucketDiffCommand&>(*messageKeeper()._msgs[1]);
+        auto reply = std::make_shared<api::ApplyBucketDiffReply>(cmd3);
+        auto& diff = reply->getDiff();
+        ASSERT_EQ(2u, diff.size());
+        // Only fill first diff entry to simulate max chunk size being exceeded on node 1.
+        fill_entry(diff[0], *doc1, getEnv().getDocumentTypeRepo());
+        handler.handleApplyBucketDiffReply(*reply, messageKeeper(), createTracker(reply, _bucket));
+    }
+    ASSERT_EQ(3u, messageKeeper()._msgs.size());
+    ASSERT_EQ(api::MessageType::APPLYBUCKETDIFF, messageKeeper()._msgs[2]->getType());
+    {
+        // Write of doc1 to local node is not waited for before sending the next round.
+        auto s = getEnv()._fileStorHandler.editMergeStatus(_bucket);
+        EXPECT_TRUE(s->delayed_error.has_value());
+        EXPECT_EQ(1u, s->diff.size());
+    }
+    {
+        auto& cmd4 = dynamic_cast<api::ApplyBucketDiffCommand&>(*messageKeeper()._msgs[2]);
+        auto reply = std::make_shared<api::ApplyBucketDiffReply>(cmd4);
+        auto& diff = reply->getDiff();
+        ASSERT_EQ(1u, diff.size());
+        EXPECT_EQ(EntryCheck(20100u, 2u), diff[0]._entry);
+        fill_entry(diff[0], *doc2, getEnv().getDocumentTypeRepo());
+        handler.handleApplyBucketDiffReply(*reply, messageKeeper(), createTracker(reply, _bucket));
+    }
+    handler.drain_async_writes();
+    ASSERT_EQ(4u, messageKeeper()._msgs.size());
+    ASSERT_EQ(api::MessageType::MERGEBUCKET_REPLY, messageKeeper()._msgs[3]->getType());
+    EXPECT_TRUE(dynamic_cast<api::MergeBucketReply&>(*messageKeeper()._msgs[3]).getResult().success());
+}
+
 TEST_F(MergeHandlerTest, multiple_versions_in_apply_diff_only_writes_newest_version) {
     setUpChain(BACK);
 
@@ -37,6 +37,40 @@ uint32_t per_stripe_merge_limit(uint32_t num_threads, uint32_t num_stripes) noex
     return std::max(1u, (num_threads / num_stripes) / 2);
 }
 
+bool
+message_type_is_merge_related(api::MessageType::Id msg_type_id) noexcept {
+    switch (msg_type_id) {
+    case api::MessageType::MERGEBUCKET_ID:
+    case api::MessageType::MERGEBUCKET_REPLY_ID:
+    case api::MessageType::GETBUCKETDIFF_ID:
+    case api::MessageType::GETBUCKETDIFF_REPLY_ID:
+    case api::MessageType::APPLYBUCKETDIFF_ID:
+    case api::MessageType::APPLYBUCKETDIFF_REPLY_ID:
+    // DeleteBucket is usually (but not necessarily) executed in the context of a higher-level
+    // merge operation, but we include it here since we want to enforce that not all threads
+    // in a stripe can dispatch a bucket delete at the same time. This also provides a strict
+    // upper bound on the number of in-flight bucket deletes in the persistence core.
+    case api::MessageType::DELETEBUCKET_ID:
+        return true;
+    default: return false;
+    }
+}
+
+constexpr uint8_t exclusive_lock_class_bit = 1;
+constexpr uint8_t merge_lock_class_bit = 2;
+constexpr uint8_t num_lock_classes = 4;
+
+uint8_t lock_class_of(const api::StorageMessage& msg) noexcept {
+    uint8_t lock_class = 0;
+    if (msg.lockingRequirements() == api::LockingRequirements::Exclusive) {
+        lock_class |= exclusive_lock_class_bit;
+    }
+    if (message_type_is_merge_related(msg.getType().getId())) {
+        lock_class |= merge_lock_class_bit;
+    }
+    return lock_class;
+}
+
 }
 
 FileStorHandlerImpl::FileStorHandlerImpl(MessageSender& sender, FileStorMetrics& metrics,
@@ -717,20 +751,8 @@ FileStorHandlerImpl::remapMessage(api::StorageMessage& msg, const document::Buck
 void
 FileStorHandlerImpl::remapQueueNoLock(const RemapInfo& source, std::vector<RemapInfo*>& targets, Operation op)
 {
-    BucketIdx& idx(stripe(source.bucket).exposeBucketIdx());
-    auto range(idx.equal_range(source.bucket));
-
-    std::vector<MessageEntry> entriesFound;
-
-    // Find all the messages for the given bucket.
-    for (BucketIdx::iterator i = range.first; i != range.second; ++i) {
-        assert(i->_bucket == source.bucket);
-
-        entriesFound.push_back(std::move(*i));
-    }
-
-    // Remove them
-    idx.erase(range.first, range.second);
+    // Find and remove all the messages for the given bucket.
+    std::vector<MessageEntry> entriesFound = stripe(source.bucket).unsafe_take_queued(source.bucket);
 
     // Reinsert all that can be remapped.
     for (uint32_t i = 0; i < entriesFound.size(); ++i) {
@@ -761,13 +783,9 @@ FileStorHandlerImpl::remapQueueNoLock(const RemapInfo& source, std::vector<Remap
             assert(bucket == source.bucket || std::find_if(targets.begin(), targets.end(), [bucket](auto* e){
                 return e->bucket == bucket;
             }) != targets.end());
-            stripe(bucket).exposeQueue().emplace_back(std::move(entry));
+            stripe(bucket).unsafe_enqueue(std::move(entry));
         }
     }
-    stripe(source.bucket).unsafe_update_cached_queue_size();
-    for (const auto *target: targets) {
-        stripe(target->bucket).unsafe_update_cached_queue_size();
-    }
 }
 
 void
@@ -852,6 +870,7 @@ FileStorHandlerImpl::Stripe::failOperations(const document::Bucket &bucket, cons
             ++iter;
         }
     }
+    refresh_ready(bucket);
     update_cached_queue_size(guard);
 }
 
@@ -879,7 +898,9 @@ FileStorHandlerImpl::MessageEntry::MessageEntry(const std::shared_ptr<api::Stora
     : _command(cmd),
       _timer(scheduled_at_time),
       _bucket(bucket),
-      _priority(cmd->getPriority())
+      _priority(cmd->getPriority()),
+      _lock_class(lock_class_of(*cmd)),
+      _seq_no(0)
 { }
 
 
@@ -887,7 +908,9 @@ FileStorHandlerImpl::MessageEntry::MessageEntry(const MessageEntry& entry) noexc
     : _command(entry._command),
       _timer(entry._timer),
       _bucket(entry._bucket),
-      _priority(entry._priority)
+      _priority(entry._priority),
+      _lock_class(entry._lock_class),
+      _seq_no(entry._seq_no)
 { }
 
 
@@ -895,7 +918,9 @@ FileStorHandlerImpl::MessageEntry::MessageEntry(MessageEntry && entry) noexcept
     : _command(std::move(entry._command)),
       _timer(entry._timer),
       _bucket(entry._bucket),
-      _priority(entry._priority)
+      _priority(entry._priority),
+      _lock_class(entry._lock_class),
+      _seq_no(entry._seq_no)
 { }
 
 FileStorHandlerImpl::MessageEntry::~MessageEntry() = default;
@@ -922,6 +947,8 @@ FileStorHandlerImpl::Stripe::Stripe(const FileStorHandlerImpl & owner, MessageSe
       _lock(std::make_unique<std::mutex>()),
       _cond(std::make_unique<std::condition_variable>()),
       _queue(std::make_unique<PriorityQueue>()),
+      _ready(std::make_unique<ReadySet>()),
+      _next_seq_no(0),
       _cached_queue_size(_queue->size()),
       _lockedBuckets(),
       _active_merges(0),
@@ -964,14 +991,10 @@ FileStorHandlerImpl::Stripe::next_message_impl(monitor_guard& guard, vespalib::s
     // second attempt. This is key to allowing the run loop to register
     // ticks at regular intervals while not busy-waiting.
     for (int attempt = 0; (attempt < 2) && !_owner.isPaused(); ++attempt) {
-        PriorityIdx& idx(bmi::get<1>(*_queue));
-        PriorityIdx::iterator iter(idx.begin()), end(idx.end());
+        LockClassIdx::iterator iter = first_runnable();
         bool was_throttled = false;
 
-        while ((iter != end) && operationIsInhibited(guard, iter->_bucket, *iter->_command)) {
-            iter++;
-        }
-        if (iter != end) {
+        if (iter != bmi::get<3>(*_queue).end()) {
             const bool should_throttle_op = operation_type_should_be_throttled(iter->_command->getType().getId());
             if (!should_throttle_op && throttle_token.valid()) {
                 throttle_token.reset(); // Let someone else play with it.
@@ -984,7 +1007,7 @@ FileStorHandlerImpl::Stripe::next_message_impl(monitor_guard& guard, vespalib::s
                 }
             }
             if (!should_throttle_op || throttle_token.valid()) {
-                return getMessage(guard, idx, iter, std::move(throttle_token));
+                return getMessage(guard, iter, std::move(throttle_token));
             }
         }
         if (attempt == 0) {
@@ -1092,6 +1115,7 @@ FileStorHandlerImpl::Stripe::fill_feed_op_batch(monitor_guard& guard, LockedMess
         batch.messages.emplace_back(it->_command, std::move(throttle_token));
         it = idx.erase(it);
     }
+    refresh_ready(batch.lock->getBucket());
     update_cached_queue_size(guard);
 }
 
@@ -1101,18 +1125,13 @@ FileStorHandlerImpl::Stripe::get_next_async_message(monitor_guard& guard)
     if (_owner.isPaused()) {
         return {};
     }
-    PriorityIdx& idx(bmi::get<1>(*_queue));
-    PriorityIdx::iterator iter(idx.begin()), end(idx.end());
-
-    while ((iter != end) && operationIsInhibited(guard, iter->_bucket, *iter->_command)) {
-        ++iter;
-    }
-    if ((iter != end) && AsyncHandler::is_async_unconditional_message(*(iter->_command))) {
+    LockClassIdx::iterator iter = first_runnable();
+    if ((iter != bmi::get<3>(*_queue).end()) && AsyncHandler::is_async_unconditional_message(*(iter->_command))) {
         // This is executed in the context of an RPC thread, so only do a _non-blocking_
         // poll of the throttle policy.
         auto throttle_token = _owner.operation_throttler().try_acquire_one();
         if (throttle_token.valid()) {
-            return getMessage(guard, idx, iter, std::move(throttle_token));
+            return getMessage(guard, iter, std::move(throttle_token));
         } else {
             _metrics->throttled_rpc_direct_dispatches.inc();
         }
@@ -1121,7 +1140,7 @@ FileStorHandlerImpl::Stripe::get_next_async_message(monitor_guard& guard)
 }
 
 FileStorHandler::LockedMessage
-FileStorHandlerImpl::Stripe::getMessage(monitor_guard & guard, PriorityIdx & idx, PriorityIdx::iterator iter,
+FileStorHandlerImpl::Stripe::getMessage(monitor_guard & guard, LockClassIdx::iterator iter,
                                         ThrottleToken throttle_token)
 {
     std::chrono::milliseconds waitTime(uint64_t(iter->_timer.stop(
@@ -1130,7 +1149,9 @@ FileStorHandlerImpl::Stripe::getMessage(monitor_guard & guard, PriorityIdx & idx
 
     std::shared_ptr<api::StorageMessage> msg = iter->_command; // iter is const; can't std::move()
     document::Bucket bucket(iter->_bucket);
-    idx.erase(iter); // iter not used after this point.
+    uint8_t lock_class = iter->_lock_class;
+    bmi::get<3>(*_queue).erase(iter); // iter not used after this point.
+    refresh_ready(bucket, lock_class);
     update_cached_queue_size(guard);
 
     if (!messageTimedOutInQueue(*msg, waitTime)) {
@@ -1181,15 +1202,20 @@ FileStorHandlerImpl::Stripe::abort(std::vector<std::shared_ptr<api::StorageReply
                                    const AbortBucketOperationsCommand& cmd)
 {
     std::lock_guard lockGuard(*_lock);
+    std::vector<document::Bucket> aborted_buckets;
     for (auto it(_queue->begin()); it != _queue->end();) {
         api::StorageMessage& msg(*it->_command);
         if (messageMayBeAborted(msg) && cmd.shouldAbort(it->_bucket)) {
             aborted.emplace_back(static_cast<api::StorageCommand&>(msg).makeReply());
+            aborted_buckets.push_back(it->_bucket);
             it = _queue->erase(it);
         } else {
             ++it;
         }
     }
+    for (const auto & bucket : aborted_buckets) {
+        refresh_ready(bucket);
+    }
     update_cached_queue_size(lockGuard);
 }
 
@@ -1198,7 +1224,7 @@ FileStorHandlerImpl::Stripe::schedule(MessageEntry messageEntry)
 {
     {
         std::lock_guard guard(*_lock);
-        _queue->emplace_back(std::move(messageEntry));
+        enqueue(std::move(messageEntry));
         update_cached_queue_size(guard);
     }
     _cond->notify_one();
@@ -1209,7 +1235,7 @@ FileStorHandler::LockedMessage
 FileStorHandlerImpl::Stripe::schedule_and_get_next_async_message(MessageEntry entry)
 {
     std::unique_lock guard(*_lock);
-    _queue->emplace_back(std::move(entry));
+    enqueue(std::move(entry));
     update_cached_queue_size(guard);
     auto lockedMessage = get_next_async_message(guard);
     if ( ! lockedMessage.msg) {
@@ -1219,36 +1245,90 @@ FileStorHandlerImpl::Stripe::schedule_and_get_next_async_message(MessageEntry en
 }
 
 void
-FileStorHandlerImpl::Stripe::flush()
+FileStorHandlerImpl::Stripe::enqueue(MessageEntry entry)
 {
-    std::unique_lock guard(*_lock);
-    while (!(_queue->empty() && _lockedBuckets.empty())) {
-        LOG(debug, "Still %ld in queue and %ld locked buckets", _queue->size(), _lockedBuckets.size());
-        _cond->wait_for(guard, 100ms);
+    entry._seq_no = _next_seq_no++;
+    document::Bucket bucket(entry._bucket);
+    uint8_t lock_class = entry._lock_class;
+    _queue->emplace_back(std::move(entry));
+    refresh_ready(bucket, lock_class);
+}
+
+void
+FileStorHandlerImpl::Stripe::refresh_ready(const document::Bucket & bucket, uint8_t lock_class)
+{
+    auto& ready_classes = bmi::get<1>(*_ready);
+    auto found = ready_classes.find(boost::make_tuple(bucket, lock_class));
+    if (found != ready_classes.end()) {
+        ready_classes.erase(found);
+    }
+    auto lock_req = (lock_class & exclusive_lock_class_bit) ? api::LockingRequirements::Exclusive
+                                                            : api::LockingRequirements::Shared;
+    if (bucket_is_locked(bucket, lock_req)) {
+        return;
+    }
+    auto& idx = bmi::get<3>(*_queue);
+    auto head = idx.lower_bound(boost::make_tuple(bucket, lock_class));
+    if ((head != idx.end()) && (head->_bucket == bucket) && (head->_lock_class == lock_class)) {
+        _ready->insert(ReadyEntry{head->_priority, head->_seq_no, bucket, lock_class});
     }
 }
 
-namespace {
+void
+FileStorHandlerImpl::Stripe::refresh_ready(const document::Bucket & bucket)
+{
+    for (uint8_t lock_class = 0; lock_class < num_lock_classes; ++lock_class) {
+        refresh_ready(bucket, lock_class);
+    }
+}
 
-bool
-message_type_is_merge_related(api::MessageType::Id msg_type_id) noexcept {
-    switch (msg_type_id) {
-    case api::MessageType::MERGEBUCKET_ID:
-    case api::MessageType::MERGEBUCKET_REPLY_ID:
-    case api::MessageType::GETBUCKETDIFF_ID:
-    case api::MessageType::GETBUCKETDIFF_REPLY_ID:
-    case api::MessageType::APPLYBUCKETDIFF_ID:
-    case api::MessageType::APPLYBUCKETDIFF_REPLY_ID:
-    // DeleteBucket is usually (but not necessarily) executed in the context of a higher-level
-    // merge operation, but we include it here since we want to enforce that not all threads
-    // in a stripe can dispatch a bucket delete at the same time. This also provides a strict
-    // upper bound on the number of in-flight bucket deletes in the persistence core.
-    case api::MessageType::DELETEBUCKET_ID:
-        return true;
-    default: return false;
+FileStorHandlerImpl::LockClassIdx::iterator
+FileStorHandlerImpl::Stripe::first_runnable()
+{
+    auto& idx = bmi::get<3>(*_queue);
+    const bool merges_inhibited = (_active_merges >= _owner._max_active_merges_per_stripe);
+    for (const auto & ready : *_ready) {
+        if (merges_inhibited && (ready._lock_class & merge_lock_class_bit)) {
+            continue;
+        }
+        auto iter = idx.find(boost::make_tuple(ready._bucket, ready._lock_class, ready._priority, ready._seq_no));
+        assert(iter != idx.end());
+        return iter;
+    }
+    return idx.end();
+}
+
+std::vector<FileStorHandlerImpl::MessageEntry>
+FileStorHandlerImpl::Stripe::unsafe_take_queued(const document::Bucket & bucket)
+{
+    BucketIdx& idx(bmi::get<2>(*_queue));
+    auto range(idx.equal_range(bucket));
+    std::vector<MessageEntry> entries;
+    for (auto i = range.first; i != range.second; ++i) {
+        assert(i->_bucket == bucket);
+        entries.push_back(*i);
     }
+    idx.erase(range.first, range.second);
+    refresh_ready(bucket);
+    unsafe_update_cached_queue_size();
+    return entries;
 }
 
+void
+FileStorHandlerImpl::Stripe::unsafe_enqueue(MessageEntry entry)
+{
+    enqueue(std::move(entry));
+    unsafe_update_cached_queue_size();
+}
+
+void
+FileStorHandlerImpl::Stripe::flush()
+{
+    std::unique_lock guard(*_lock);
+    while (!(_queue->empty() && _lockedBuckets.empty())) {
+        LOG(debug, "Still %ld in queue and %ld locked buckets", _queue->size(), _lockedBuckets.size());
+        _cond->wait_for(guard, 100ms);
+    }
 }
 
 void
@@ -1283,10 +1363,11 @@ FileStorHandlerImpl::Stripe::release(const document::Bucket & bucket,
     Clock::time_point now_ts = Clock::now();
     double latency = std::chrono::duration<double, std::milli>(now_ts - start_time).count();
     _active_operations_stats.guard().stats().operation_done(latency);
-    if (!entry._exclusiveLock && entry._sharedLocks.empty()) {
+    bool emptySharedLocks = entry._sharedLocks.empty();
+    if (!entry._exclusiveLock && emptySharedLocks) {
         _lockedBuckets.erase(iter); // No more locks held
     }
-    bool emptySharedLocks = entry._sharedLocks.empty();
+    refresh_ready(bucket);
     if (wasExclusive) {
         _cond->notify_all();
     } else if (emptySharedLocks) {
@@ -1324,12 +1405,20 @@ FileStorHandlerImpl::Stripe::lock(const monitor_guard &, const document::Bucket
         (void) inserted;
         assert(inserted.second);
     }
+    refresh_ready(bucket);
     _active_operations_stats.guard().stats().operation_started();
 }
 
 bool
 FileStorHandlerImpl::Stripe::isLocked(const monitor_guard &, const document::Bucket& bucket,
                                       api::LockingRequirements lockReq) const noexcept
+{
+    return bucket_is_locked(bucket, lockReq);
+}
+
+bool
+FileStorHandlerImpl::Stripe::bucket_is_locked(const document::Bucket& bucket,
+                                              api::LockingRequirements lockReq) const noexcept
 {
     if (bucket.getBucketId().getRawId() == 0) {
         return false;
@@ -1347,18 +1436,6 @@ FileStorHandlerImpl::Stripe::isLocked(const monitor_guard &, const document::Buc
             && !iter->second._sharedLocks.empty());
 }
 
-bool
-FileStorHandlerImpl::Stripe::operationIsInhibited(const monitor_guard & guard, const document::Bucket& bucket,
-                                                  const api::StorageMessage& msg) const noexcept
-{
-    if (message_type_is_merge_related(msg.getType().getId())
-        && (_active_merges >= _owner._max_active_merges_per_stripe))
-    {
-        return true;
-    }
-    return isLocked(guard, bucket, msg.lockingRequirements());
-}
-
 ActiveOperationsStats
 FileStorHandlerImpl::Stripe::get_active_operations_stats(bool reset_min_max) const
 {
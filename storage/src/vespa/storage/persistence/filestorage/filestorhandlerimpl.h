@@ -23,6 +23,7 @@
 #include <vespa/storageframework/generic/metric/metricupdatehook.h>
 #include <vespa/storageapi/messageapi/storagereply.h>
 #include <boost/multi_index_container.hpp>
+#include <boost/multi_index/composite_key.hpp>
 #include <boost/multi_index/identity.hpp>
 #include <boost/multi_index/member.hpp>
 #include <boost/multi_index/mem_fun.hpp>
@@ -54,6 +55,8 @@ public:
         metrics::MetricTimer _timer;
         document::Bucket _bucket;
         uint8_t _priority;
+        uint8_t _lock_class;
+        uint64_t _seq_no; // Assigned by the stripe when queued
 
         MessageEntry(const std::shared_ptr<api::StorageMessage>& cmd,
                      const document::Bucket& bucket,
@@ -71,9 +74,34 @@ public:
     // ordered_non_unique shall preserve insertion order as iteration order of equal keys, but this is rather magical...
     using PriorityOrder = bmi::ordered_non_unique<bmi::identity<MessageEntry>>;
     using BucketOrder   = bmi::ordered_non_unique<bmi::member<MessageEntry, document::Bucket, &MessageEntry::_bucket>>;
-    using PriorityQueue = bmi::multi_index_container<MessageEntry, bmi::indexed_by<bmi::sequenced<>, PriorityOrder, BucketOrder>>;
+    // All operations towards a bucket with the same lock class are either runnable or inhibited at
+    // the same time. Within a class, operations are ordered by priority and then by queueing order.
+    using LockClassOrder = bmi::ordered_unique<bmi::composite_key<MessageEntry,
+            bmi::member<MessageEntry, document::Bucket, &MessageEntry::_bucket>,
+            bmi::member<MessageEntry, uint8_t, &MessageEntry::_lock_class>,
+            bmi::member<MessageEntry, uint8_t, &MessageEntry::_priority>,
+            bmi::member<MessageEntry, uint64_t, &MessageEntry::_seq_no>>>;
+    using PriorityQueue = bmi::multi_index_container<MessageEntry, bmi::indexed_by<bmi::sequenced<>, PriorityOrder, BucketOrder, LockClassOrder>>;
     using PriorityIdx   = bmi::nth_index<PriorityQueue, 1>::type;
     using BucketIdx     = bmi::nth_index<PriorityQueue, 2>::type;
+    using LockClassIdx  = bmi::nth_index<PriorityQueue, 3>::type;
+
+    // The first queued operation of each lock class whose bucket is not locked in a conflicting way.
+    // The next operation to run is the first entry in priority order that is not inhibited by the
+    // merge limit, found without scanning past operations towards locked buckets.
+    struct ReadyEntry {
+        uint8_t          _priority;
+        uint64_t         _seq_no;
+        document::Bucket _bucket;
+        uint8_t          _lock_class;
+    };
+    using ReadyOrder     = bmi::ordered_unique<bmi::composite_key<ReadyEntry,
+            bmi::member<ReadyEntry, uint8_t, &ReadyEntry::_priority>,
+            bmi::member<ReadyEntry, uint64_t, &ReadyEntry::_seq_no>>>;
+    using ReadyClassOrder = bmi::ordered_unique<bmi::composite_key<ReadyEntry,
+            bmi::member<ReadyEntry, document::Bucket, &ReadyEntry::_bucket>,
+            bmi::member<ReadyEntry, uint8_t, &ReadyEntry::_lock_class>>>;
+    using ReadySet      = bmi::multi_index_container<ReadyEntry, bmi::indexed_by<ReadyOrder, ReadyClassOrder>>;
 
     using Clock = std::chrono::steady_clock;
     using monitor_guard = std::unique_lock<std::mutex>;
@@ -143,9 +171,6 @@ public:
                      api::StorageMessage::Id lockMsgId, bool was_active_merge);
         void decrease_active_sync_merges_counter() noexcept;
 
-        // Subsumes isLocked
-        bool operationIsInhibited(const monitor_guard &, const document::Bucket&,
-                                  const api::StorageMessage&) const noexcept;
         bool isLocked(const monitor_guard &, const document::Bucket&,
                       api::LockingRequirements lockReq) const noexcept;
 
@@ -162,8 +187,9 @@ public:
         void dumpActiveHtml(std::ostream & os) const;
         void dumpQueueHtml(std::ostream & os) const;
         [[nodiscard]] std::mutex & exposeLock() { return *_lock; }
-        [[nodiscard]] PriorityQueue & exposeQueue() { return *_queue; }
-        [[nodiscard]] BucketIdx & exposeBucketIdx() { return bmi::get<2>(*_queue); }
+        // Caller must hold the lock returned by exposeLock().
+        [[nodiscard]] std::vector<MessageEntry> unsafe_take_queued(const document::Bucket & bucket);
+        void unsafe_enqueue(MessageEntry entry);
         void setMetrics(FileStorStripeMetrics * metrics) { _metrics = metrics; }
         [[nodiscard]] ActiveOperationsStats get_active_operations_stats(bool reset_min_max) const;
     private:
@@ -176,6 +202,13 @@ public:
         [[nodiscard]] bool hasActive(monitor_guard & monitor, const AbortBucketOperationsCommand& cmd) const;
         [[nodiscard]] FileStorHandler::LockedMessage get_next_async_message(monitor_guard& guard);
         [[nodiscard]] bool operation_type_should_be_throttled(api::MessageType::Id type_id) const noexcept;
+        [[nodiscard]] bool bucket_is_locked(const document::Bucket & bucket, api::LockingRequirements lockReq) const noexcept;
+
+        // The helpers below must be called with the stripe lock held.
+        void enqueue(MessageEntry entry);
+        void refresh_ready(const document::Bucket & bucket, uint8_t lock_class);
+        void refresh_ready(const document::Bucket & bucket);
+        [[nodiscard]] LockClassIdx::iterator first_runnable();
 
         [[nodiscard]] FileStorHandler::LockedMessage next_message_impl(monitor_guard& held_lock,
                                                                        vespalib::steady_time deadline);
@@ -184,8 +217,7 @@ public:
 
         // Precondition: the bucket used by `iter`s operation is not locked in a way that conflicts
         // with its locking requirements.
-        [[nodiscard]] FileStorHandler::LockedMessage getMessage(monitor_guard & guard, PriorityIdx & idx,
-                                                                PriorityIdx::iterator iter,
+        [[nodiscard]] FileStorHandler::LockedMessage getMessage(monitor_guard & guard, LockClassIdx::iterator iter,
                                                                 ThrottleToken throttle_token);
         using LockedBuckets = vespalib::hash_map<document::Bucket, MultiLockEntry, document::Bucket::hash>;
         const FileStorHandlerImpl      &_owner;
@@ -194,6 +226,8 @@ public:
         std::unique_ptr<std::mutex>                _lock;
         std::unique_ptr<std::condition_variable>   _cond;
         std::unique_ptr<PriorityQueue>  _queue;
+        std::unique_ptr<ReadySet>       _ready;
+        uint64_t                        _next_seq_no;
         atomic_size_t                   _cached_queue_size;
         LockedBuckets                   _lockedBuckets;
         uint32_t                        _active_merges;
@@ -829,11 +829,18 @@ MergeHandler::processBucketMerge(const spi::Bucket& bucket, MergeStatus& status,
     }
     cmd->setPriority(status.context.getPriority());
     cmd->setTimeout(status.timeout);
+    const bool need_local_data = applyDiffNeedLocalData(cmd->getDiff(), 0, true);
     if (async_results) {
-        // Check currently pending writes to local node before sending new command.
-        check_apply_diff_sync(std::move(async_results));
+        if (need_local_data) {
+            // Local data is read below, check currently pending writes to local node before sending new command.
+            check_apply_diff_sync(std::move(async_results));
+        } else {
+            // Let pending writes to local node overlap with the next round. At most one round of
+            // writes is outstanding, reply handler checks for delayed error before applying more.
+            status.set_delayed_error(async_results->get_future());
+        }
     }
-    if (applyDiffNeedLocalData(cmd->getDiff(), 0, true)) {
+    if (need_local_data) {
         framework::MilliSecTimer startTime(_clock);
         fetchLocalData(bucket, cmd->getDiff(), 0, context);
         _env._metrics.merge_handler_metrics.mergeDataReadLatency.addValue(startTime.getElapsedTimeAsDouble());
@@ -734,7 +734,11 @@ Visitor::onGetIterReply(const std::shared_ptr<GetIterReply>& reply, VisitorThrea
         LOG(debug, "Processing documents in handle given from bucket %s.", reply->getBucketId().toString().c_str());
         // While handling documents we should not keep locks, such
         // that visitor may process several things at once.
-        if (isRunning()) {
+        if (isRunning() && isDoneVisiting()) {
+            // Blocks arriving after the visitor is done are neither handled
+            // nor counted as visited.
+            LOG(debug, "Visitor %s is done, skipping block of %zu documents.", _id.c_str(), reply->getEntries().size());
+        } else if (isRunning()) {
             MBUS_TRACE(reply->getTrace(), 5,
                        vespalib::make_string("Visitor %s handling block of %zu documents.",
                                              _id.c_str(), reply->getEntries().size()));
@@ -831,6 +835,11 @@ Visitor::continueVisitor()
                 if (!_calledCompletedVisitor) {
                     VISITOR_TRACE(7, "Visitor marked as complete, calling completedVisiting()");
                     _calledCompletedVisitor = true;
+                    if (isDoneVisiting()) {
+                        VISITOR_TRACE(5, vespalib::make_string("Visitor done early, abandoned %zu of %zu buckets",
+                                                               _buckets.size() - _visitorStatistics.getBucketsVisited(),
+                                                               _buckets.size()));
+                    }
                     try{
                         completedVisiting(*_hitCounter);
                     } catch (std::exception& e) {
@@ -1021,6 +1030,8 @@ Visitor::getIterators()
         }
     }
 
+    const bool done_visiting = isDoneVisiting();
+
     // Go through buckets found. Take the first that doesn't have requested
     // state and request a new piece.
     for (auto it = _bucketStates.begin();it != _bucketStates.end();) {
@@ -1051,6 +1062,17 @@ Visitor::getIterators()
             it = _bucketStates.erase(it);
             continue;
         }
+        if (done_visiting) {
+            if (bucketState._pendingIterators > 0) {
+                ++it;
+                continue;
+            }
+            LOG(debug, "Visitor '%s' is done, abandoning bucket %s.",
+                _id.c_str(), bucketState.getBucketId().toString().c_str());
+            delete *it;
+            it = _bucketStates.erase(it);
+            continue;
+        }
         auto cmd = std::make_shared<GetIterCommand>(bucketState.getBucket(), bucketState.getIteratorId(), _docBlockSize);
         cmd->getTrace().setLevel(_traceLevel);
         cmd->setPriority(_priority);
@@ -1063,7 +1085,7 @@ Visitor::getIterators()
     }
 
     // If there aren't anymore buckets to iterate, we're done
-    if (_bucketStates.empty() && _currentBucket >= _buckets.size()) {
+    if (_bucketStates.empty() && (done_visiting || _currentBucket >= _buckets.size())) {
         LOG(debug, "No more buckets to visit for visitor '%s'.", _id.c_str());
         return false;
     }
@@ -1074,7 +1096,8 @@ Visitor::getIterators()
     uint32_t sentCount = 0;
     while (_bucketStates.size() < _visitorOptions._maxParallel &&
            _bucketStates.size() < _visitorOptions._maxPending &&
-           _currentBucket < _buckets.size())
+           _currentBucket < _buckets.size() &&
+           !done_visiting)
     {
         document::Bucket bucket(_bucketSpace, _buckets[_currentBucket]);
         auto newBucketState = std::make_unique<BucketIterationState>(*this, *_messageHandler, bucket);
@@ -384,6 +384,14 @@ public:
      */
     virtual void completedBucket(const document::BucketId&, HitCounter&) {}
 
+    /**
+     * Override this to stop visiting before all buckets have been iterated,
+     * e.g. when enough documents have been seen. Buckets not yet completed
+     * are then abandoned without calling completedBucket(), and document
+     * blocks still in flight are neither handled nor counted as visited.
+     */
+    [[nodiscard]] virtual bool isDoneVisiting() const { return false; }
+
     /**
      * Override this if you want to know if visiting is aborted. Note that you
      * cannot use this callback to send anything.
@@ -252,6 +252,7 @@ TEST_F(SearchVisitorTest, basic_query_execution_in_search_visitor)
     // Document summaries are ordered in document id order:
     expect_summary({{5}, {7}, {9}}, *res);
     expect_match_features({}, {}, *res);
+    EXPECT_FALSE(res->getSearchResult().is_early_terminated());
 }
 
 TEST_F(SearchVisitorTest, match_features_returned_in_search_result)
@@ -265,6 +266,33 @@ TEST_F(SearchVisitorTest, match_features_returned_in_search_result)
     expect_match_features({"attribute(id)", "myfunc"}, {{5.0}, {25.0}, {7.0}, {27.0}}, *res);
 }
 
+TEST_F(SearchVisitorTest, matching_is_terminated_early_when_enough_hits_are_kept)
+{
+    auto params = RequestBuilder().
+            rank_profile("early_termination").
+            summary_count(2).
+            number_term("[5;10]", "id").build();
+    auto session = make_visitor_session(params);
+    auto entries = make_documents({{3},{5},{4},{7},{9}});
+    session->handle_documents(entries);
+    EXPECT_TRUE(session->visitor.isDoneVisiting());
+    auto res = session->generate_query_result();
+    expect_hits({{7,17.0}, {5,15.0}}, *res);
+    EXPECT_EQ(2u, res->getSearchResult().getTotalHitCount());
+    EXPECT_TRUE(res->getSearchResult().is_early_terminated());
+}
+
+TEST_F(SearchVisitorTest, early_termination_is_disabled_when_no_hits_are_wanted)
+{
+    auto res = execute_query(RequestBuilder().
+                                     rank_profile("early_termination").
+                                     summary_count(0).
+                                     number_term("[5;10]", "id").build(),
+                             {{5},{7},{9}});
+    EXPECT_EQ(3u, res->getSearchResult().getTotalHitCount());
+    EXPECT_FALSE(res->getSearchResult().is_early_terminated());
+}
+
 TEST_F(SearchVisitorTest, visitor_only_require_weak_read_consistency)
 {
     vdslib::Parameters params;
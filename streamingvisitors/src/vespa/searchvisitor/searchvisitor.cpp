@@ -28,6 +28,8 @@
 #include <vespa/vespalib/text/stringtokenizer.h>
 #include <vespa/fnet/databuffer.h>
 #include <vespa/fastlib/text/normwordfolder.h>
+#include <algorithm>
+#include <cmath>
 #include <optional>
 #include <string>
 
@@ -312,6 +314,8 @@ SearchVisitor::SearchVisitor(StorageComponent& component,
       _docSearchedCount(0),
       _hitCount(0),
       _hitsRejectedCount(0),
+      _earlyTerminationHitLimit(0),
+      _earlyTerminated(false),
       _query(),
       _queryResult(std::make_unique<documentapi::QueryResultMessage>()),
       _fieldSearcherMap(),
@@ -525,6 +529,7 @@ SearchVisitor::init(const Parameters & params)
 
             _rankController.setRankManagerSnapshot(_env->get_rank_manager_snapshot());
             _rankController.setupRankProcessors(_query, location, wantedSummaryCount, ! _sortSpec.empty(), _attrMan, _attributeFields);
+            setupEarlyTermination(wantedSummaryCount, hasGrouping);
 
             // This depends on _fieldPathMap (from setupScratchDocument),
             // and IQueryEnvironment (from setupRankProcessors).
@@ -686,6 +691,7 @@ SearchVisitor::RankController::RankController()
     : _rankProfile("default"),
       _rankManagerSnapshot(nullptr),
       _rank_score_drop_limit(),
+      _early_termination_factor(0.0),
       _hasRanking(false),
       _hasSummaryFeatures(false),
       _dumpFeatures(false),
@@ -705,8 +711,10 @@ SearchVisitor::RankController::setupRankProcessors(Query & query,
                                                    std::vector<AttrInfo> & attributeFields)
 {
     using FirstPhaseRankScoreDropLimit = search::fef::indexproperties::hitcollector::FirstPhaseRankScoreDropLimit;
+    using EarlyTerminationFactor = search::fef::indexproperties::hitcollector::EarlyTerminationFactor;
     const search::fef::RankSetup & rankSetup = _rankManagerSnapshot->getRankSetup(_rankProfile);
     _rank_score_drop_limit = FirstPhaseRankScoreDropLimit::lookup(_queryProperties, rankSetup.get_first_phase_rank_score_drop_limit());
+    _early_termination_factor = EarlyTerminationFactor::lookup(_queryProperties, rankSetup.getEarlyTerminationFactor());
     _rankProcessor = std::make_unique<RankProcessor>(_rankManagerSnapshot, _rankProfile, query, location, _queryProperties, _featureOverrides, &attrMan);
     _rankProcessor->initForRanking(wantedHitCount, use_sort_blob);
     // register attribute vectors needed for ranking
@@ -1097,6 +1105,10 @@ SearchVisitor::handleDocuments(const document::BucketId&, DocEntryList & entries
     const document::DocumentType* defaultDocType = _docTypeMapping.getDefaultDocumentType();
     assert(defaultDocType);
     for (const auto & entry : entries) {
+        if (_earlyTerminated) {
+            LOG(debug, "SearchVisitor '%s' terminated early, skipping remaining documents", _id.c_str());
+            break;
+        }
         auto document = std::make_shared<StorageDocument>(entry->releaseDocument(), _fieldPathMap, highestFieldNo);
 
         try {
@@ -1140,6 +1152,9 @@ SearchVisitor::handleDocument(StorageDocument::SP documentSP)
                 _summaryGenerator.getDocsumCallback().setSummaryFeatures(_rankController.getFeatureSet(document.getDocId()));
             }
             group(document.docDoc(), rp.getRankScore(), false);
+            if ((_earlyTerminationHitLimit > 0) && ((_hitCount - _hitsRejectedCount) >= _earlyTerminationHitLimit)) {
+                _earlyTerminated = true;
+            }
         } else {
             _hitsRejectedCount++;
             LOG(debug, "Do not keep document with id '%s' because rank score (%f) <= rank score drop limit (%f)",
@@ -1241,6 +1256,17 @@ SearchVisitor::fillSortBuffer()
     return pos;
 }
 
+void
+SearchVisitor::setupEarlyTermination(size_t wantedSummaryCount, bool hasGrouping)
+{
+    double factor = _rankController.early_termination_factor();
+    if (hasGrouping || (wantedSummaryCount == 0) || !(factor > 0.0)) {
+        return;
+    }
+    _earlyTerminationHitLimit = std::max(wantedSummaryCount, size_t(std::ceil(wantedSummaryCount * factor)));
+    LOG(debug, "Early termination after %zu kept hits", _earlyTerminationHitLimit);
+}
+
 void
 SearchVisitor::completedBucket(const document::BucketId&, HitCounter&)
 {
@@ -1270,7 +1296,9 @@ SearchVisitor::completedVisitingInternal(HitCounter& hitCounter)
 
     /// Now I can sort. No more documentid access order.
     searchResult.sort();
+    // Only a lower bound when terminated early, reported as degraded coverage by the container.
     searchResult.setTotalHitCount(_hitCount - _hitsRejectedCount);
+    searchResult.set_early_terminated(_earlyTerminated);
 
     const char* docId;
     vdslib::SearchResult::RankType rank;
@@ -129,6 +129,7 @@ private:
         std::string               _rankProfile;
         std::shared_ptr<const RankManager::Snapshot>  _rankManagerSnapshot;
         std::optional<search::feature_t> _rank_score_drop_limit;
+        double                         _early_termination_factor;
         bool                           _hasRanking;
         bool                           _hasSummaryFeatures;
         bool                           _dumpFeatures;
@@ -159,6 +160,7 @@ private:
         void setDumpFeatures(bool dumpFeatures) { _dumpFeatures = dumpFeatures; }
         bool getDumpFeatures() const { return _dumpFeatures; }
         std::optional<search::feature_t> rank_score_drop_limit() const noexcept { return _rank_score_drop_limit; }
+        double early_termination_factor() const noexcept { return _early_termination_factor; }
 
         /**
          * Setup rank processors used for ranking and dumping.
@@ -364,6 +366,17 @@ private:
     // Inherit doc from Visitor
     void completedVisiting(HitCounter& counter) override;
 
+    // Inherit doc from Visitor
+    bool isDoneVisiting() const override { return _earlyTerminated; }
+
+    /**
+     * Setup early termination, stopping matching when enough hits have been kept.
+     *
+     * @param wantedSummaryCount number of hits wanted.
+     * @param hasGrouping whether the query has grouping, which needs all hits.
+     **/
+    void setupEarlyTermination(size_t wantedSummaryCount, bool hasGrouping);
+
     storage::spi::ReadConsistency getRequiredReadConsistency() const override {
         // Searches are not considered to require strong consistency.
         return storage::spi::ReadConsistency::WEAK;
@@ -464,6 +477,8 @@ private:
     size_t                                  _docSearchedCount;
     size_t                                  _hitCount;
     size_t                                  _hitsRejectedCount;
+    size_t                                  _earlyTerminationHitLimit;
+    bool                                    _earlyTerminated;
     search::streaming::Query                _query;
     std::unique_ptr<documentapi::QueryResultMessage>    _queryResult;
     vsm::FieldIdTSearcherMap                _fieldSearcherMap;
@@ -64,8 +64,10 @@ public class SearchResult {
     private final Hit[]  hits;
     private final TreeMap<Integer, byte []> aggregatorList;
     private final TreeMap<Integer, byte []> groupingList;
+    private final boolean earlyTerminated;
     private static final int EXTENSION_FLAGS_PRESENT = -1;
     private static final int MATCH_FEATURES_PRESENT_MASK = 1;
+    private static final int EARLY_TERMINATED_MASK = 2;
 
     public SearchResult(Deserializer buf) {
         BufferSerializer bser = (BufferSerializer) buf; // TODO: dirty cast. must do this differently
@@ -123,6 +125,7 @@ public class SearchResult {
         if (hasMatchFeatures(extensionFlags)) {
             deserializeMatchFeatures(buf, numHits);
         }
+        earlyTerminated = isEarlyTerminated(extensionFlags);
     }
 
     private void deserializeMatchFeatures(Deserializer buf, int numHits) {
@@ -155,6 +158,10 @@ public class SearchResult {
         return (extensionFlags & MATCH_FEATURES_PRESENT_MASK) != 0;
     }
 
+    private static boolean isEarlyTerminated(int extensionFlags) {
+        return (extensionFlags & EARLY_TERMINATED_MASK) != 0;
+    }
+
     private static boolean isDoubleFeature(byte featureType) {
         return featureType == 0;
     }
@@ -163,4 +170,6 @@ public class SearchResult {
     final public int getTotalHitCount() { return (totalHits != 0) ? totalHits : getHitCount(); }
     final public Hit getHit(int hitNo)  { return hits[hitNo]; }
     final public Map<Integer, byte []> getGroupingList() { return groupingList; }
+    /** Returns whether matching was terminated before all documents were visited, making the total hit count a lower bound. */
+    final public boolean isEarlyTerminated() { return earlyTerminated; }
 }
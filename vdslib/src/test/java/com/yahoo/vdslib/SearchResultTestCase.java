@@ -1,9 +1,11 @@
 // Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
 package com.yahoo.vdslib;
 
+import com.yahoo.vespa.objects.BufferSerializer;
 import org.junit.Test;
 
 import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
 import static org.junit.Assert.assertTrue;
 
 /**
@@ -89,4 +91,28 @@ public class SearchResultTestCase {
         assertTrue(h6.compareTo(h5) > 0);
         assertEquals(0, h6.compareTo(h6));
     }
+
+    private static SearchResult createSearchResult(int extensionFlags) {
+        BufferSerializer serializer = new BufferSerializer();
+        serializer.putInt(null, 17); // total hits
+        serializer.putInt(null, -1); // extension flags present
+        serializer.putInt(null, extensionFlags);
+        serializer.putInt(null, 0); // hit count
+        serializer.putInt(null, 0); // sort blob count
+        serializer.putInt(null, 0); // aggregator count
+        serializer.putInt(null, 0); // grouping count
+        serializer.getBuf().flip();
+        return new SearchResult(serializer);
+    }
+
+    @Test
+    public void requireThatEarlyTerminationIsDecoded() {
+        SearchResult complete = createSearchResult(0);
+        assertFalse(complete.isEarlyTerminated());
+        assertEquals(17, complete.getTotalHitCount());
+        SearchResult terminated = createSearchResult(2);
+        assertTrue(terminated.isEarlyTerminated());
+        assertEquals(17, terminated.getTotalHitCount());
+        assertEquals(0, terminated.getHitCount());
+    }
 }
@@ -164,4 +164,22 @@ TEST(SearchResultTest, test_deserialized_match_features)
     check_match_features(serialize(sr), "deserialized sorted", true);
 }
 
+TEST(SearchResultTest, test_early_terminated)
+{
+    SearchResult sr;
+    EXPECT_FALSE(sr.is_early_terminated());
+    SearchResult sr2;
+    deserialize(sr2, serialize(sr));
+    EXPECT_FALSE(sr2.is_early_terminated());
+    sr.set_early_terminated(true);
+    SearchResult sr3;
+    deserialize(sr3, serialize(sr));
+    EXPECT_TRUE(sr3.is_early_terminated());
+    sr.addHit(7, "doc1", 5);
+    SearchResult sr4;
+    deserialize(sr4, serialize(sr));
+    EXPECT_TRUE(sr4.is_early_terminated());
+    EXPECT_EQ(1u, sr4.getHitCount());
+}
+
 }
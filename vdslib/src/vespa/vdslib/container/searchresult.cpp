@@ -15,6 +15,7 @@ constexpr uint32_t extension_flags_present = 0xffffffffu;
 
 // Extension flag values
 constexpr uint32_t match_features_present_mask = 1;
+constexpr uint32_t early_terminated_mask = 2;
 
 // Selector values for feature value
 constexpr uint8_t feature_value_is_double = 0;
@@ -24,6 +25,10 @@ inline bool has_match_features(uint32_t extension_flags) {
     return ((extension_flags & match_features_present_mask) != 0);
 }
 
+inline bool has_early_terminated(uint32_t extension_flags) {
+    return ((extension_flags & early_terminated_mask) != 0);
+}
+
 inline bool must_serialize_extension_flags(uint32_t extension_flags, uint32_t hit_count) {
     return ((extension_flags != 0) || (hit_count == extension_flags_present));
 }
@@ -125,7 +130,8 @@ SearchResult::SearchResult() :
     _wantedHits(10),
     _hits(),
     _docIdBuffer(),
-    _numDocIdBytes(0)
+    _numDocIdBytes(0),
+    _early_terminated(false)
 {
     _docIdBuffer.reset(new vespalib::MallocPtr(4_Ki));
 }
@@ -139,7 +145,8 @@ SearchResult::SearchResult(document::ByteBuffer & buf) :
     _aggregatorList(),
     _groupingList(),
     _sortBlob(),
-    _match_features()
+    _match_features(),
+    _early_terminated(false)
 {
     deserialize(buf);
 }
@@ -181,6 +188,7 @@ SearchResult::deserialize(document::ByteBuffer & buf)
     if (has_match_features(extension_flags)) {
         deserialize_match_features(buf);
     }
+    _early_terminated = has_early_terminated(extension_flags);
 }
 
 void SearchResult::serialize(vespalib::GrowableByteBuffer & buf) const
@@ -243,6 +251,9 @@ SearchResult::calc_extension_flags(uint32_t hit_count) const noexcept
     if (!_match_features.names.empty() && hit_count != 0) {
         extension_flags |= match_features_present_mask;
     }
+    if (_early_terminated) {
+        extension_flags |= early_terminated_mask;
+    }
     return extension_flags;
 }
 
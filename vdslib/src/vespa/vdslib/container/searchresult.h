@@ -85,6 +85,13 @@ public:
     void addHit(uint32_t lid, const char * docId, RankType rank);
     void addHit(uint32_t lid, const char * docId, RankType rank, const void * sortData, size_t sz);
     void set_match_features(FeatureValues&& match_features);
+    /**
+     * Set when matching was terminated before all documents were
+     * visited, since enough hits had been collected. Coverage is then
+     * degraded, and the total hit count is a lower bound.
+     */
+    void set_early_terminated(bool value) noexcept { _early_terminated = value; }
+    bool is_early_terminated() const noexcept { return _early_terminated; }
     void sort();
 
     void deserialize(document::ByteBuffer & buf);
@@ -148,6 +155,7 @@ private:
     AggregatorList               _groupingList;
     BlobContainer                _sortBlob;
     FeatureValues                _match_features;
+    bool                         _early_terminated;
 };
 
 }
@@ -3,6 +3,9 @@
 #include <vespa/vespalib/testkit/test_kit.h>
 #include <vespa/vespalib/testkit/test_master.hpp>
 #include <vespa/vespalib/util/compressor.h>
+#include <vespa/vespalib/util/exceptions.h>
+#include <vespa/vespalib/util/zstdcompressor.h>
+#include <vespa/vespalib/util/stringfmt.h>
 #include <vespa/vespalib/data/databuffer.h>
 #include <atomic>
 #include <string>
@@ -69,6 +72,71 @@ TEST("requiret that zstd compression/decompression works") {
     EXPECT_EQUAL(_G_compressableText, std::string(decompress.data(), decompress.size()));
 }
 
+namespace {
+
+std::string
+make_sample(size_t i) {
+    return make_string("{\"id\":\"id:music:song::%zu\",\"title\":\"Song number %zu\",\"artist\":\"Artist %zu\","
+                       "\"genre\":\"rock\",\"year\":%zu,\"duration\":%zu}", i, i*7, i % 13, 1950 + (i % 70), 120 + (i % 300));
+}
+
+std::unique_ptr<ZStdDictionary>
+train_dictionary() {
+    DataBuffer samples;
+    std::vector<size_t> sizes;
+    for (size_t i(0); i < 2000; i++) {
+        std::string sample = make_sample(i);
+        samples.writeBytes(sample.data(), sample.size());
+        sizes.push_back(sample.size());
+    }
+    return ZStdDictionary::train(ConstBufferRef(samples.getData(), samples.getDataLen()), sizes, 4096);
+}
+
+}
+
+TEST("require that zstd dictionary compression/decompression works") {
+    auto dictionary = train_dictionary();
+    ASSERT_TRUE(dictionary);
+    EXPECT_NOT_EQUAL(0u, dictionary->id());
+    EXPECT_LESS_EQUAL(dictionary->content().size(), 4096u);
+
+    std::string text = make_sample(4711);
+    ConstBufferRef ref(text.c_str(), text.size());
+    CompressionConfig cfg(CompressionConfig::Type::ZSTD, 9, 100, 0);
+    DataBuffer plain;
+    compress(cfg, ref, plain, false);
+    ZStdDictCompressor zstd(*dictionary);
+    DataBuffer withDictionary;
+    EXPECT_EQUAL(CompressionConfig::Type::ZSTD, compress(zstd, cfg, ref, withDictionary, false));
+    EXPECT_LESS(withDictionary.getDataLen(), plain.getDataLen());
+
+    DataBuffer decompressed;
+    decompress(zstd, text.size(), ConstBufferRef(withDictionary.getData(), withDictionary.getDataLen()), decompressed, false);
+    EXPECT_EQUAL(text, std::string(decompressed.getData(), decompressed.getDataLen()));
+}
+
+TEST("require that zstd dictionary decompression handles frames compressed without dictionary") {
+    auto dictionary = train_dictionary();
+    ASSERT_TRUE(dictionary);
+    Compress plain(CompressionConfig(CompressionConfig::Type::ZSTD), _G_compressableText.c_str(), _G_compressableText.size());
+    EXPECT_EQUAL(CompressionConfig::Type::ZSTD, plain.type());
+    ZStdDictCompressor zstd(*dictionary);
+    DataBuffer decompressed;
+    decompress(zstd, _G_compressableText.size(), ConstBufferRef(plain.data(), plain.size()), decompressed, false);
+    EXPECT_EQUAL(_G_compressableText, std::string(decompressed.getData(), decompressed.getDataLen()));
+}
+
+TEST("require that zstd dictionary training fails gracefully without samples") {
+    EXPECT_FALSE(ZStdDictionary::train(ConstBufferRef(), std::vector<size_t>(), 4096));
+}
+
+TEST("require that corrupt zstd dictionary is rejected") {
+    auto dictionary = train_dictionary();
+    ASSERT_TRUE(dictionary);
+    ConstBufferRef content = dictionary->content();
+    EXPECT_EXCEPTION(ZStdDictionary(ConstBufferRef(content.c_str(), 16)), IllegalArgumentException, "Corrupt zstd dictionary");
+}
+
 TEST("require that CompressionConfig is Atomic") {
     EXPECT_EQUAL(8u, sizeof(CompressionConfig));
     EXPECT_TRUE(std::atomic<CompressionConfig>::is_always_lock_free);
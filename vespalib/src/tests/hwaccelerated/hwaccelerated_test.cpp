@@ -3,6 +3,7 @@
 #include <vespa/vespalib/testkit/test_kit.h>
 #include <vespa/vespalib/hwaccelerated/iaccelerated.h>
 #include <vespa/vespalib/hwaccelerated/generic.h>
+#include <cmath>
 #include <vespa/log/log.h>
 LOG_SETUP("hwaccelerated_test");
 
@@ -17,6 +18,25 @@ std::vector<T> createAndFill(size_t sz) {
     return v;
 }
 
+template<>
+std::vector<int8_t> createAndFill<int8_t>(size_t sz) {
+    std::vector<int8_t> v(sz);
+    for (size_t i(0); i < sz; i++) {
+        v[i] = int8_t(rand()%256 - 128);
+    }
+    return v;
+}
+
+template<>
+std::vector<BFloat16> createAndFill<BFloat16>(size_t sz) {
+    // Signed values that are not exact in bfloat16
+    std::vector<BFloat16> v(sz);
+    for (size_t i(0); i < sz; i++) {
+        v[i] = BFloat16(float(rand()%10001 - 5000) / 37.0f);
+    }
+    return v;
+}
+
 template<typename T, typename P>
 void verifyEuclideanDistance(const hwaccelerated::IAccelerated & accel, size_t testLength, double approxFactor) {
     srand(1);
@@ -38,6 +58,30 @@ verifyEuclideanDistance(const hwaccelerated::IAccelerated & accelrator, size_t t
     verifyEuclideanDistance<int8_t, double>(accelrator, testLength, 0.0);
     verifyEuclideanDistance<float, double>(accelrator, testLength, 0.0001); // Small deviation requiring EXPECT_APPROX
     verifyEuclideanDistance<double, double>(accelrator, testLength, 0.0);
+    verifyEuclideanDistance<BFloat16, double>(accelrator, testLength, 0.0001);
+}
+
+template<typename T, typename P>
+void verifyDotProduct(const hwaccelerated::IAccelerated & accel, size_t testLength, double approxFactor) {
+    srand(1);
+    std::vector<T> a = createAndFill<T>(testLength);
+    std::vector<T> b = createAndFill<T>(testLength);
+    for (size_t j(0); j < 0x20; j++) {
+        P sum(0);
+        P absSum(0);
+        for (size_t i(j); i < testLength; i++) {
+            sum += P(a[i]) * P(b[i]);
+            absSum += std::abs(P(a[i]) * P(b[i]));
+        }
+        P hwComputedSum(accel.dotProduct(&a[j], &b[j], testLength - j));
+        EXPECT_APPROX(sum, hwComputedSum, absSum*approxFactor);
+    }
+}
+
+void
+verifyDotProduct(const hwaccelerated::IAccelerated & accelrator, size_t testLength) {
+    verifyDotProduct<int8_t, double>(accelrator, testLength, 0.0);
+    verifyDotProduct<BFloat16, double>(accelrator, testLength, 0.0001);
 }
 
 TEST("test euclidean distance") {
@@ -47,4 +91,10 @@ TEST("test euclidean distance") {
     TEST_DO(verifyEuclideanDistance(hwaccelerated::IAccelerated::getAccelerator(), TEST_LENGTH));
 }
 
+TEST("test dot product") {
+    constexpr size_t TEST_LENGTH = 140000; // must be longer than 64k
+    TEST_DO(verifyDotProduct(hwaccelerated::GenericAccelrator(), TEST_LENGTH));
+    TEST_DO(verifyDotProduct(hwaccelerated::IAccelerated::getAccelerator(), TEST_LENGTH));
+}
+
 TEST_MAIN() { TEST_RUN_ALL(); }
@@ -460,6 +460,35 @@ TEST_F(SocketTest, require_that_reuse_addr_can_be_set_and_cleared)
     }
 }
 
+TEST_F(SocketTest, require_that_reuse_port_can_be_set_and_cleared)
+{
+    SocketHandle handle(socket(my_inet(), SOCK_STREAM, 0));
+    test::SocketOptionsVerifier verifier(handle.get());
+    EXPECT_TRUE(!SocketOptions::set_reuse_port(-1, true));
+    EXPECT_TRUE(handle.set_reuse_port(true));
+    {
+        SCOPED_TRACE("verify reuse port true");
+        verifier.verify_reuse_port(true);
+    }
+    EXPECT_TRUE(handle.set_reuse_port(false));
+    {
+        SCOPED_TRACE("verify reuse port false");
+        verifier.verify_reuse_port(false);
+    }
+}
+
+TEST_F(SocketTest, require_that_server_sockets_can_share_port_with_reuse_port)
+{
+    ServerSocket server1(SocketSpec::from_port(0), true);
+    ASSERT_TRUE(server1.valid());
+    int port = server1.address().port();
+    ServerSocket server2(SocketSpec::from_port(port), true);
+    ASSERT_TRUE(server2.valid());
+    EXPECT_EQ(port, server2.address().port());
+    ServerSocket server3(SocketSpec::from_port(port));
+    EXPECT_FALSE(server3.valid());
+}
+
 TEST_F(SocketTest, require_that_ipv6_only_can_be_set_and_cleared)
 {
     if (ipv6_enabled) {
@@ -125,6 +125,17 @@ TEST("require that replace_host gives invalid spec when used with less than 2 ho
     TEST_DO(verify_invalid(SocketSpec("ipc/name:my_socket").replace_host("foo")));
 }
 
+TEST("require that replace_port makes new spec with replaced port") {
+    TEST_DO(verify_host_port(SocketSpec("tcp/host:123").replace_port(456), "host", 456));
+    TEST_DO(verify_port(SocketSpec("tcp/123").replace_port(456), 456));
+}
+
+TEST("require that replace_port gives invalid spec when used with non-tcp spec") {
+    TEST_DO(verify_invalid(SocketSpec("bogus").replace_port(456)));
+    TEST_DO(verify_invalid(SocketSpec("ipc/file:my_socket").replace_port(456)));
+    TEST_DO(verify_invalid(SocketSpec("ipc/name:my_socket").replace_port(456)));
+}
+
 TEST("require that invalid socket spec is not valid") {
     EXPECT_FALSE(SocketSpec::invalid.valid());
 }
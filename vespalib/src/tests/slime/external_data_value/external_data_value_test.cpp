@@ -25,6 +25,13 @@ void verify_data(const Inspector &pos, Memory expect) {
     EXPECT_EQUAL(pos.asData(), expect);
 }
 
+void verify_string(const Inspector &pos, Memory expect) {
+    EXPECT_TRUE(pos.valid());
+    EXPECT_EQUAL(vespalib::slime::STRING::ID, pos.type().getId());
+    EXPECT_EQUAL(pos.asData(), Memory());
+    EXPECT_EQUAL(pos.asString(), expect);
+}
+
 TEST("require that external memory can be used for data values") {
     Slime slime;
     TEST_DO(verify_data(slime.setData(MyMem::create("foo")), Memory("foo")));
@@ -83,4 +90,39 @@ TEST("require that external memory can be used with object symbol inserter") {
     TEST_DO(verify_data(slime.get()[Symbol(5)], Memory("foo")));
 }
 
+TEST("require that external memory can be used for string values") {
+    Slime slime;
+    TEST_DO(verify_string(slime.setExternalString(MyMem::create("foo")), Memory("foo")));
+    TEST_DO(verify_string(slime.get(), Memory("foo")));
+}
+
+TEST("require that nullptr external memory gives empty string value") {
+    Slime slime;
+    TEST_DO(verify_string(slime.setExternalString(ExternalMemory::UP(nullptr)), Memory("")));
+    TEST_DO(verify_string(slime.get(), Memory("")));
+}
+
+TEST("require that external memory can be used with array and object string values") {
+    Slime slime;
+    Cursor &arr = slime.setArray();
+    TEST_DO(verify_string(arr.addExternalString(MyMem::create("foo")), Memory("foo")));
+    Cursor &obj = arr.addObject();
+    TEST_DO(verify_string(obj.setExternalString("field", MyMem::create("bar")), Memory("bar")));
+    TEST_DO(verify_string(obj.setExternalString(Symbol(5), MyMem::create("baz")), Memory("baz")));
+    TEST_DO(verify_string(slime.get()[0], Memory("foo")));
+    TEST_DO(verify_string(slime.get()[1]["field"], Memory("bar")));
+    TEST_DO(verify_string(slime.get()[1][Symbol(5)], Memory("baz")));
+}
+
+TEST("require that external memory can be used with string inserters") {
+    Slime slime;
+    Cursor &arr = slime.setArray();
+    TEST_DO(verify_string(ArrayInserter(arr).insertExternalString(MyMem::create("foo")), Memory("foo")));
+    Cursor &obj = arr.addObject();
+    TEST_DO(verify_string(ObjectInserter(obj, "field").insertExternalString(MyMem::create("bar")), Memory("bar")));
+    TEST_DO(verify_string(ObjectSymbolInserter(obj, Symbol(5)).insertExternalString(MyMem::create("baz")), Memory("baz")));
+    Slime slime2;
+    TEST_DO(verify_string(SlimeInserter(slime2).insertExternalString(MyMem::create("foo")), Memory("foo")));
+}
+
 TEST_MAIN() { TEST_RUN_ALL(); }
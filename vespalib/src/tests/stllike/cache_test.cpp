@@ -48,6 +48,65 @@ TEST("testCache") {
     EXPECT_TRUE(cache.size() == 1);
 }
 
+TEST("require that populate inserts without touching backing store") {
+    B m;
+    cache< CacheParam<P, B> > cache(m, -1);
+    cache.populate(1, "Fetched elsewhere", cache.getGeneration(1));
+    EXPECT_TRUE(cache.hasKey(1));
+    EXPECT_TRUE(m.find(1) == m.end());
+    EXPECT_EQUAL(cache.read(1), "Fetched elsewhere");
+    EXPECT_EQUAL(1u, cache.getInsert());
+    cache.write(2, "Written");
+    cache.populate(2, "Stale", cache.getGeneration(2));
+    EXPECT_EQUAL(cache.read(2), "Written");
+    EXPECT_EQUAL(1u, cache.getRace());
+}
+
+TEST("require that populate is skipped when key is written or invalidated after generation was captured") {
+    B m;
+    cache< CacheParam<P, B> > cache(m, -1);
+    uint64_t generation = cache.getGeneration(1);
+    cache.invalidate(1);
+    cache.populate(1, "Removed", generation);
+    EXPECT_FALSE(cache.hasKey(1));
+    EXPECT_EQUAL(1u, cache.getRace());
+
+    generation = cache.getGeneration(2);
+    cache.write(2, "Written");
+    cache.invalidate(2);
+    cache.populate(2, "Stale", generation);
+    EXPECT_FALSE(cache.hasKey(2));
+    EXPECT_EQUAL(cache.read(2), "Written");
+    EXPECT_EQUAL(2u, cache.getRace());
+
+    generation = cache.getGeneration(3);
+    cache.invalidate(4);
+    cache.populate(3, "Fresh", generation);
+    EXPECT_TRUE(cache.hasKey(3));
+}
+
+template<typename K, typename V>
+class AdmittingMap : public Map<K, V> {
+public:
+    bool admit(const K & k, const V &) const { return (k % 2) == 0; }
+};
+
+TEST("require that objects not admitted by backing store are returned but not inserted") {
+    AdmittingMap<uint32_t, vespa_string> m;
+    cache< CacheParam<P, AdmittingMap<uint32_t, vespa_string>> > cache(m, -1);
+    m[1] = "Not admitted";
+    m[2] = "Admitted";
+    EXPECT_EQUAL(cache.read(1), "Not admitted");
+    EXPECT_FALSE(cache.hasKey(1));
+    EXPECT_EQUAL(cache.read(2), "Admitted");
+    EXPECT_TRUE(cache.hasKey(2));
+    EXPECT_EQUAL(cache.read(3), "");
+    EXPECT_EQUAL(1u, cache.getNotAdmitted());
+    EXPECT_EQUAL(1u, cache.getNoneExisting());
+    EXPECT_EQUAL(1u, cache.getInsert());
+    EXPECT_EQUAL(3u, cache.getMiss());
+}
+
 TEST("testCacheSize")
 {
     B m;
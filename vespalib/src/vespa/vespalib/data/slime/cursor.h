@@ -17,6 +17,7 @@ struct Cursor : public Inspector {
     virtual Cursor &addLong(int64_t l) = 0;
     virtual Cursor &addDouble(double d) = 0;
     virtual Cursor &addString(Memory str) = 0;
+    virtual Cursor &addExternalString(ExternalMemory::UP str) = 0;
     virtual Cursor &addData(Memory data) = 0;
     virtual Cursor &addData(ExternalMemory::UP data) = 0;
     virtual Cursor &addArray(size_t reserved_size) = 0;
@@ -27,6 +28,7 @@ struct Cursor : public Inspector {
     virtual Cursor &setLong(Symbol sym, int64_t l) = 0;
     virtual Cursor &setDouble(Symbol sym, double d) = 0;
     virtual Cursor &setString(Symbol sym, Memory str) = 0;
+    virtual Cursor &setExternalString(Symbol sym, ExternalMemory::UP str) = 0;
     virtual Cursor &setData(Symbol sym, Memory data) = 0;
     virtual Cursor &setData(Symbol sym, ExternalMemory::UP data) = 0;
     virtual Cursor &setArray(Symbol sym, size_t reserved_size) = 0;
@@ -37,6 +39,7 @@ struct Cursor : public Inspector {
     virtual Cursor &setLong(Memory name, int64_t l) = 0;
     virtual Cursor &setDouble(Memory name, double d) = 0;
     virtual Cursor &setString(Memory name, Memory str) = 0;
+    virtual Cursor &setExternalString(Memory name, ExternalMemory::UP str) = 0;
     virtual Cursor &setData(Memory name, Memory data) = 0;
     virtual Cursor &setData(Memory name, ExternalMemory::UP data) = 0;
     virtual Cursor &setArray(Memory name, size_t reserved_size) = 0;
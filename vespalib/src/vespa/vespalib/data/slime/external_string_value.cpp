@@ -0,0 +1,7 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "external_string_value.h"
+
+namespace vespalib::slime {
+
+} // namespace vespalib::slime
@@ -0,0 +1,23 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include "value.h"
+#include "external_memory.h"
+
+namespace vespalib::slime {
+
+/**
+ * A string value backed by external memory.
+ **/
+class ExternalStringValue : public Value
+{
+private:
+    ExternalMemory::UP _value;
+public:
+    ExternalStringValue(ExternalMemory::UP str) : _value(std::move(str)) {}
+    Memory asString() const override { return _value->get(); }
+    Type type() const override { return STRING::instance; }
+};
+
+} // namespace vespalib::slime
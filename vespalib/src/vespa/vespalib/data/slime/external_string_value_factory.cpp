@@ -0,0 +1,26 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#include "external_string_value_factory.h"
+#include "external_string_value.h"
+#include "basic_value.h"
+#include <vespa/vespalib/util/stash.h>
+
+namespace vespalib::slime {
+
+ExternalStringValueFactory::ExternalStringValueFactory(std::unique_ptr<ExternalMemory> in)
+    : input(std::move(in))
+{
+}
+
+ExternalStringValueFactory::~ExternalStringValueFactory() = default;
+
+Value *
+ExternalStringValueFactory::create(Stash &stash) const
+{
+    if (!input) {
+        return &stash.create<BasicStringValue>(Memory(), stash);
+    }
+    return &stash.create<ExternalStringValue>(std::move(input));
+}
+
+} // namespace vespalib::slime
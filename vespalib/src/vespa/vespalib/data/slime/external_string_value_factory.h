@@ -0,0 +1,22 @@
+// Copyright Vespa.ai. Licensed under the terms of the Apache 2.0 license. See LICENSE in the project root.
+
+#pragma once
+
+#include "value_factory.h"
+#include <memory>
+
+namespace vespalib::slime {
+
+struct ExternalMemory;
+
+/**
+ * Value factory for string values using external memory.
+ **/
+struct ExternalStringValueFactory : public ValueFactory {
+    mutable std::unique_ptr<ExternalMemory> input;
+    ExternalStringValueFactory(std::unique_ptr<ExternalMemory> in);
+    ~ExternalStringValueFactory() override;
+    Value *create(Stash &stash) const override;
+};
+
+} // namespace vespalib::slime
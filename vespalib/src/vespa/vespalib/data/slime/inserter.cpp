@@ -12,6 +12,7 @@ Cursor &SlimeInserter::insertBool(bool value)     const { return slime.setBool(v
 Cursor &SlimeInserter::insertLong(int64_t value)  const { return slime.setLong(value); }
 Cursor &SlimeInserter::insertDouble(double value) const { return slime.setDouble(value); }
 Cursor &SlimeInserter::insertString(Memory value) const { return slime.setString(value); }
+Cursor &SlimeInserter::insertExternalString(ExtMemUP value) const { return slime.setExternalString(std::move(value)); }
 Cursor &SlimeInserter::insertData(Memory value)   const { return slime.setData(value); }
 Cursor &SlimeInserter::insertData(ExtMemUP value) const { return slime.setData(std::move(value)); }
 Cursor &SlimeInserter::insertArray(size_t resv)   const { return slime.setArray(resv); }
@@ -22,6 +23,7 @@ Cursor &ArrayInserter::insertBool(bool value)     const { return cursor.addBool(
 Cursor &ArrayInserter::insertLong(int64_t value)  const { return cursor.addLong(value); }
 Cursor &ArrayInserter::insertDouble(double value) const { return cursor.addDouble(value); }
 Cursor &ArrayInserter::insertString(Memory value) const { return cursor.addString(value); }
+Cursor &ArrayInserter::insertExternalString(ExtMemUP value) const { return cursor.addExternalString(std::move(value)); }
 Cursor &ArrayInserter::insertData(Memory value)   const { return cursor.addData(value); }
 Cursor &ArrayInserter::insertData(ExtMemUP value) const { return cursor.addData(std::move(value)); }
 Cursor &ArrayInserter::insertArray(size_t resv)   const { return cursor.addArray(resv); }
@@ -32,6 +34,7 @@ Cursor &ObjectSymbolInserter::insertBool(bool value)     const { return cursor.s
 Cursor &ObjectSymbolInserter::insertLong(int64_t value)  const { return cursor.setLong(symbol, value); }
 Cursor &ObjectSymbolInserter::insertDouble(double value) const { return cursor.setDouble(symbol, value); }
 Cursor &ObjectSymbolInserter::insertString(Memory value) const { return cursor.setString(symbol, value); }
+Cursor &ObjectSymbolInserter::insertExternalString(ExtMemUP value) const { return cursor.setExternalString(symbol, std::move(value)); }
 Cursor &ObjectSymbolInserter::insertData(Memory value)   const { return cursor.setData(symbol, value); }
 Cursor &ObjectSymbolInserter::insertData(ExtMemUP value) const { return cursor.setData(symbol, std::move(value)); }
 Cursor &ObjectSymbolInserter::insertArray(size_t resv)   const { return cursor.setArray(symbol, resv); }
@@ -42,6 +45,7 @@ Cursor &ObjectInserter::insertBool(bool value)     const { return cursor.setBool
 Cursor &ObjectInserter::insertLong(int64_t value)  const { return cursor.setLong(name, value); }
 Cursor &ObjectInserter::insertDouble(double value) const { return cursor.setDouble(name, value); }
 Cursor &ObjectInserter::insertString(Memory value) const { return cursor.setString(name, value); }
+Cursor &ObjectInserter::insertExternalString(ExtMemUP value) const { return cursor.setExternalString(name, std::move(value)); }
 Cursor &ObjectInserter::insertData(Memory value)   const { return cursor.setData(name, value); }
 Cursor &ObjectInserter::insertData(ExtMemUP value) const { return cursor.setData(name, std::move(value)); }
 Cursor &ObjectInserter::insertArray(size_t resv)   const { return cursor.setArray(name, resv); }
@@ -25,6 +25,7 @@ struct Inserter {
     virtual Cursor &insertLong(int64_t value) const = 0;
     virtual Cursor &insertDouble(double value) const = 0;
     virtual Cursor &insertString(Memory value) const = 0;
+    virtual Cursor &insertExternalString(ExternalMemory::UP value) const = 0;
     virtual Cursor &insertData(Memory value) const = 0;
     virtual Cursor &insertData(ExternalMemory::UP value) const = 0;
     virtual Cursor &insertArray(size_t reserved) const = 0;
@@ -47,6 +48,7 @@ struct SlimeInserter : Inserter {
     Cursor &insertLong(int64_t value) const override;
     Cursor &insertDouble(double value) const override;
     Cursor &insertString(Memory value) const override;
+    Cursor &insertExternalString(ExternalMemory::UP value) const override;
     Cursor &insertData(Memory value) const override;
     Cursor &insertData(ExternalMemory::UP value) const override;
     Cursor &insertArray(size_t reserved) const override;
@@ -62,6 +64,7 @@ struct ArrayInserter : Inserter {
     Cursor &insertLong(int64_t value) const override;
     Cursor &insertDouble(double value) const override;
     Cursor &insertString(Memory value) const override;
+    Cursor &insertExternalString(ExternalMemory::UP value) const override;
     Cursor &insertData(Memory value) const override;
     Cursor &insertData(ExternalMemory::UP value) const override;
     Cursor &insertArray(size_t reserved) const override;
@@ -78,6 +81,7 @@ struct ObjectSymbolInserter : Inserter {
     Cursor &insertLong(int64_t value) const override;
     Cursor &insertDouble(double value) const override;
     Cursor &insertString(Memory value) const override;
+    Cursor &insertExternalString(ExternalMemory::UP value) const override;
     Cursor &insertData(Memory value) const override;
     Cursor &insertData(ExternalMemory::UP value) const override;
     Cursor &insertArray(size_t reserved) const override;
@@ -94,6 +98,7 @@ struct ObjectInserter : Inserter {
     Cursor &insertLong(int64_t value) const override;
     Cursor &insertDouble(double value) const override;
     Cursor &insertString(Memory value) const override;
+    Cursor &insertExternalString(ExternalMemory::UP value) const override;
     Cursor &insertData(Memory value) const override;
     Cursor &insertData(ExternalMemory::UP value) const override;
     Cursor &insertArray(size_t reserved) const override;
@@ -26,6 +26,7 @@
 #include "value.h"
 #include "value_factory.h"
 #include "external_data_value_factory.h"
+#include "external_string_value_factory.h"
 #include <vespa/vespalib/data/input_reader.h>
 #include <vespa/vespalib/data/output_writer.h>
 #include <vespa/vespalib/data/output.h>
@@ -120,6 +121,9 @@ public:
     Cursor &setString(const Memory& str) {
         return _root.set(slime::StringValueFactory(str));
     }
+    Cursor &setExternalString(slime::ExternalMemory::UP str) {
+        return _root.set(slime::ExternalStringValueFactory(std::move(str)));
+    }
     Cursor &setData(const Memory& data) {
         return _root.set(slime::DataValueFactory(data));
     }
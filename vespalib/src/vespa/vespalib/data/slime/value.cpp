@@ -6,6 +6,7 @@
 #include "empty_value_factory.h"
 #include "basic_value_factory.h"
 #include "external_data_value_factory.h"
+#include "external_string_value_factory.h"
 #include <vespa/vespalib/data/simple_buffer.h>
 #include "json_format.h"
 
@@ -92,6 +93,8 @@ Value::addDouble(double d) { return addLeaf(DoubleValueFactory(d)); }
 Cursor &
 Value::addString(Memory str) { return addLeaf(StringValueFactory(str)); }
 Cursor &
+Value::addExternalString(ExternalMemory::UP str) { return addLeaf(ExternalStringValueFactory(std::move(str))); }
+Cursor &
 Value::addData(Memory data) { return addLeaf(DataValueFactory(data)); }
 Cursor &
 Value::addData(ExternalMemory::UP data) { return addLeaf(ExternalDataValueFactory(std::move(data))); }
@@ -108,6 +111,8 @@ Value::setDouble(Symbol sym, double d) { return setLeaf(sym, DoubleValueFactory(
 Cursor &
 Value::setString(Symbol sym, Memory str) { return setLeaf(sym, StringValueFactory(str)); }
 Cursor &
+Value::setExternalString(Symbol sym, ExternalMemory::UP str) { return setLeaf(sym, ExternalStringValueFactory(std::move(str))); }
+Cursor &
 Value::setData(Symbol sym, Memory data) { return setLeaf(sym, DataValueFactory(data)); }
 Cursor &
 Value::setData(Symbol sym, ExternalMemory::UP data) { return setLeaf(sym, ExternalDataValueFactory(std::move(data))); }
@@ -124,6 +129,8 @@ Value::setDouble(Memory name, double d) { return setLeaf(name, DoubleValueFactor
 Cursor &
 Value::setString(Memory name, Memory str) { return setLeaf(name, StringValueFactory(str)); }
 Cursor &
+Value::setExternalString(Memory name, ExternalMemory::UP str) { return setLeaf(name, ExternalStringValueFactory(std::move(str))); }
+Cursor &
 Value::setData(Memory name, Memory data) { return setLeaf(name, DataValueFactory(data)); }
 Cursor &
 Value::setData(Memory name, ExternalMemory::UP data) { return setLeaf(name, ExternalDataValueFactory(std::move(data))); }
@@ -55,6 +55,7 @@ public:
     Cursor &addLong(int64_t l) override;
     Cursor &addDouble(double d) override;
     Cursor &addString(Memory str) override;
+    Cursor &addExternalString(ExternalMemory::UP str) override;
     Cursor &addData(Memory data) override;
     Cursor &addData(ExternalMemory::UP data) override;
     Cursor &addArray(size_t reserved_size) override;
@@ -65,6 +66,7 @@ public:
     Cursor &setLong(Symbol sym, int64_t l) override;
     Cursor &setDouble(Symbol sym, double d) override;
     Cursor &setString(Symbol sym, Memory str) override;
+    Cursor &setExternalString(Symbol sym, ExternalMemory::UP str) override;
     Cursor &setData(Symbol sym, Memory data) override;
     Cursor &setData(Symbol sym, ExternalMemory::UP data) override;
     Cursor &setArray(Symbol sym, size_t reserved_size) override;
@@ -75,6 +77,7 @@ public:
     Cursor &setLong(Memory name, int64_t l) override;
     Cursor &setDouble(Memory name, double d) override;
     Cursor &setString(Memory name, Memory str) override;
+    Cursor &setExternalString(Memory name, ExternalMemory::UP str) override;
     Cursor &setData(Memory name, Memory str) override;
     Cursor &setData(Memory name, ExternalMemory::UP data) override;
     Cursor &setArray(Memory name, size_t reserved_size) override;
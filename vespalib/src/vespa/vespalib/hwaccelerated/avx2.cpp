@@ -25,6 +25,11 @@ Avx2Accelrator::squaredEuclideanDistance(const double * a, const double * b, siz
     return avx::euclideanDistanceSelectAlignment<double, 32>(a, b, sz);
 }
 
+double
+Avx2Accelrator::squaredEuclideanDistance(const BFloat16 * a, const BFloat16 * b, size_t sz) const noexcept {
+    return helper::squaredEuclideanDistance(a, b, sz);
+}
+
 void
 Avx2Accelrator::and128(size_t offset, const std::vector<std::pair<const void *, bool>> &src, void *dest) const noexcept {
     helper::andChunks<32u, 4u>(offset, src, dest);
@@ -46,4 +51,10 @@ Avx2Accelrator::dotProduct(const int8_t * a, const int8_t * b, size_t sz) const
     return helper::multiplyAdd(a, b, sz);
 }
 
+float
+Avx2Accelrator::dotProduct(const BFloat16 * a, const BFloat16 * b, size_t sz) const noexcept
+{
+    return helper::dotProduct(a, b, sz);
+}
+
 }
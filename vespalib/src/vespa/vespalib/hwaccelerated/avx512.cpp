@@ -2,9 +2,90 @@
 
 #include "avx512.h"
 #include "avxprivate.hpp"
+#include <algorithm>
+#include <cstring>
+#include <immintrin.h>
 
 namespace vespalib:: hwaccelerated {
 
+namespace {
+
+// Number of int8 elements summed in 32-bit lanes before spilling to a 64-bit sum, keeps lanes from overflowing.
+constexpr size_t VNNI_BLOCK_SIZE = 0x2000;
+
+// Sums the lanes of a vector register. Used instead of the _mm512_reduce_add intrinsics,
+// which trigger -Wuninitialized with the headers of some gcc versions.
+template <typename T, typename V>
+T sumLanes(const V & v) noexcept {
+    T lanes[sizeof(V)/sizeof(T)];
+    memcpy(lanes, &v, sizeof(lanes));
+    T sum(0);
+    for (T lane : lanes) {
+        sum += lane;
+    }
+    return sum;
+}
+
+template <bool difference>
+__attribute__((target("avx512vnni")))
+int64_t
+vnniMultiplyAdd(const int8_t * a, const int8_t * b, size_t sz) noexcept
+{
+    int64_t sum(0);
+    size_t i(0);
+    while (i + 32 <= sz) {
+        size_t blockEnd = std::min(sz, i + VNNI_BLOCK_SIZE);
+        __m512i acc = _mm512_setzero_si512();
+        for (; i + 32 <= blockEnd; i += 32) {
+            __m512i va = _mm512_cvtepi8_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i)));
+            __m512i vb = _mm512_cvtepi8_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i)));
+            if constexpr (difference) {
+                __m512i d = _mm512_sub_epi16(va, vb);
+                acc = _mm512_dpwssd_epi32(acc, d, d);
+            } else {
+                acc = _mm512_dpwssd_epi32(acc, va, vb);
+            }
+        }
+        sum += sumLanes<int32_t>(acc);
+    }
+    for (; i < sz; i++) {
+        int32_t va = a[i];
+        int32_t vb = b[i];
+        sum += difference ? (va - vb) * (va - vb) : va * vb;
+    }
+    return sum;
+}
+
+__attribute__((target("avx512bf16")))
+float
+bf16DotProduct(const BFloat16 * a, const BFloat16 * b, size_t sz) noexcept
+{
+    __m512 acc0 = _mm512_setzero_ps();
+    __m512 acc1 = _mm512_setzero_ps();
+    size_t i(0);
+    for (; i + 64 <= sz; i += 64) {
+        acc0 = _mm512_dpbf16_ps(acc0, (__m512bh) _mm512_loadu_si512(a + i), (__m512bh) _mm512_loadu_si512(b + i));
+        acc1 = _mm512_dpbf16_ps(acc1, (__m512bh) _mm512_loadu_si512(a + i + 32), (__m512bh) _mm512_loadu_si512(b + i + 32));
+    }
+    for (; i + 32 <= sz; i += 32) {
+        acc0 = _mm512_dpbf16_ps(acc0, (__m512bh) _mm512_loadu_si512(a + i), (__m512bh) _mm512_loadu_si512(b + i));
+    }
+    float sum = sumLanes<float>(_mm512_add_ps(acc0, acc1));
+    for (; i < sz; i++) {
+        sum += a[i].to_float() * b[i].to_float();
+    }
+    return sum;
+}
+
+}
+
+Avx512Accelrator::Avx512Accelrator() noexcept
+    : Avx2Accelrator(),
+      _has_vnni(__builtin_cpu_supports("avx512vnni")),
+      _has_bf16(__builtin_cpu_supports("avx512bf16"))
+{
+}
+
 float
 Avx512Accelrator::dotProduct(const float * af, const float * bf, size_t sz) const noexcept {
     return avx::dotProductSelectAlignment<float, 64>(af, bf, sz);
@@ -22,6 +103,9 @@ Avx512Accelrator::populationCount(const uint64_t *a, size_t sz) const noexcept {
 
 double
 Avx512Accelrator::squaredEuclideanDistance(const int8_t * a, const int8_t * b, size_t sz) const noexcept {
+    if (_has_vnni) {
+        return vnniMultiplyAdd<true>(a, b, sz);
+    }
     return helper::squaredEuclideanDistance(a, b, sz);
 }
 
@@ -35,6 +119,11 @@ Avx512Accelrator::squaredEuclideanDistance(const double * a, const double * b, s
     return avx::euclideanDistanceSelectAlignment<double, 64>(a, b, sz);
 }
 
+double
+Avx512Accelrator::squaredEuclideanDistance(const BFloat16 * a, const BFloat16 * b, size_t sz) const noexcept {
+    return helper::squaredEuclideanDistance(a, b, sz);
+}
+
 void
 Avx512Accelrator::and128(size_t offset, const std::vector<std::pair<const void *, bool>> &src, void *dest) const noexcept {
     helper::andChunks<64, 2>(offset, src, dest);
@@ -53,7 +142,19 @@ Avx512Accelrator::convert_bfloat16_to_float(const uint16_t * src, float * dest,
 int64_t
 Avx512Accelrator::dotProduct(const int8_t * a, const int8_t * b, size_t sz) const noexcept
 {
+    if (_has_vnni) {
+        return vnniMultiplyAdd<false>(a, b, sz);
+    }
     return helper::multiplyAdd(a, b, sz);
 }
 
+float
+Avx512Accelrator::dotProduct(const BFloat16 * a, const BFloat16 * b, size_t sz) const noexcept
+{
+    if (_has_bf16) {
+        return bf16DotProduct(a, b, sz);
+    }
+    return helper::dotProduct(a, b, sz);
+}
+
 }
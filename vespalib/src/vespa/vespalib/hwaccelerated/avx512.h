@@ -8,18 +8,24 @@ namespace vespalib::hwaccelerated {
 
 /**
  * Avx-512 implementation.
+ * Uses AVX512-VNNI for int8 and AVX512-BF16 for bfloat16 calculations when supported by the cpu.
  */
 class Avx512Accelrator : public Avx2Accelrator
 {
+    bool _has_vnni;
+    bool _has_bf16;
 public:
+    Avx512Accelrator() noexcept;
     float dotProduct(const float * a, const float * b, size_t sz) const noexcept override;
     double dotProduct(const double * a, const double * b, size_t sz) const noexcept override;
     size_t populationCount(const uint64_t *a, size_t sz) const noexcept override;
     double squaredEuclideanDistance(const int8_t * a, const int8_t * b, size_t sz) const noexcept override;
     double squaredEuclideanDistance(const float * a, const float * b, size_t sz) const noexcept override;
     double squaredEuclideanDistance(const double * a, const double * b, size_t sz) const noexcept override;
+    double squaredEuclideanDistance(const BFloat16 * a, const BFloat16 * b, size_t sz) const noexcept override;
     void convert_bfloat16_to_float(const uint16_t * src, float * dest, size_t sz) const noexcept override;
     int64_t dotProduct(const int8_t * a, const int8_t * b, size_t sz) const noexcept override;
+    float dotProduct(const BFloat16 * a, const BFloat16 * b, size_t sz) const noexcept override;
     void and128(size_t offset, const std::vector<std::pair<const void *, bool>> &src, void *dest) const noexcept override;
     void or128(size_t offset, const std::vector<std::pair<const void *, bool>> &src, void *dest) const noexcept override;
 };
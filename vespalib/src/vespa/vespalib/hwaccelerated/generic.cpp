@@ -121,6 +121,12 @@ GenericAccelrator::dotProduct(const int64_t * a, const int64_t * b, size_t sz) c
     return multiplyAdd<long long, int64_t, 8>(a, b, sz);
 }
 
+float
+GenericAccelrator::dotProduct(const BFloat16 * a, const BFloat16 * b, size_t sz) const noexcept
+{
+    return helper::dotProduct(a, b, sz);
+}
+
 void
 GenericAccelrator::orBit(void * aOrg, const void * bOrg, size_t bytes) const noexcept
 {
@@ -177,6 +183,11 @@ GenericAccelrator::squaredEuclideanDistance(const double * a, const double * b,
     return squaredEuclideanDistanceT<double, 16>(a, b, sz);
 }
 
+double
+GenericAccelrator::squaredEuclideanDistance(const BFloat16 * a, const BFloat16 * b, size_t sz) const noexcept {
+    return helper::squaredEuclideanDistance(a, b, sz);
+}
+
 void
 GenericAccelrator::and128(size_t offset, const std::vector<std::pair<const void *, bool>> &src, void *dest) const noexcept {
     helper::andChunks<16, 8>(offset, src, dest);
@@ -7,6 +7,7 @@
 #include "avx512.h"
 #endif
 #include <vespa/vespalib/util/memory.h>
+#include <cmath>
 #include <cstdio>
 #include <vector>
 
@@ -80,6 +81,99 @@ verifyEuclideanDistance(const IAccelerated & accel) {
     }
 }
 
+std::vector<int8_t>
+createAndFillInt8(size_t sz) {
+    std::vector<int8_t> v(sz);
+    for (size_t i(0); i < sz; i++) {
+        v[i] = int8_t(rand()%256 - 128);
+    }
+    return v;
+}
+
+// Signed values that are not exact in bfloat16, so conversion rounds them
+std::vector<BFloat16>
+createAndFillSignedBFloat16(size_t sz) {
+    std::vector<BFloat16> v(sz);
+    for (size_t i(0); i < sz; i++) {
+        v[i] = BFloat16(float(rand()%2001 - 1000) / 37.0f);
+    }
+    return v;
+}
+
+void
+verifyInt8(const IAccelerated & accel) {
+    const size_t testLength(255);
+    srand(1);
+    std::vector<int8_t> a = createAndFillInt8(testLength);
+    std::vector<int8_t> b = createAndFillInt8(testLength);
+    for (size_t j(0); j < 0x20; j++) {
+        int64_t dotSum(0);
+        int64_t distSum(0);
+        for (size_t i(j); i < testLength; i++) {
+            dotSum += int64_t(a[i]) * b[i];
+            int64_t d = int64_t(a[i]) - b[i];
+            distSum += d * d;
+        }
+        if (dotSum != accel.dotProduct(&a[j], &b[j], testLength - j)) {
+            fprintf(stderr, "Accelrator is not computing int8 dotproduct correctly.\n");
+            LOG_ABORT("should not be reached");
+        }
+        if (double(distSum) != accel.squaredEuclideanDistance(&a[j], &b[j], testLength - j)) {
+            fprintf(stderr, "Accelrator is not computing int8 euclidean distance correctly.\n");
+            LOG_ABORT("should not be reached");
+        }
+    }
+}
+
+void
+verifyBFloat16(const IAccelerated & accel) {
+    const size_t testLength(255);
+    srand(1);
+    std::vector<BFloat16> a = createAndFill<BFloat16>(testLength);
+    std::vector<BFloat16> b = createAndFill<BFloat16>(testLength);
+    for (size_t j(0); j < 0x20; j++) {
+        // Small integers are exact in bfloat16, and so are the sums in float
+        float dotSum(0);
+        float distSum(0);
+        for (size_t i(j); i < testLength; i++) {
+            dotSum += a[i].to_float() * b[i].to_float();
+            float d = a[i].to_float() - b[i].to_float();
+            distSum += d * d;
+        }
+        if (dotSum != accel.dotProduct(&a[j], &b[j], testLength - j)) {
+            fprintf(stderr, "Accelrator is not computing bfloat16 dotproduct correctly.\n");
+            LOG_ABORT("should not be reached");
+        }
+        if (distSum != accel.squaredEuclideanDistance(&a[j], &b[j], testLength - j)) {
+            fprintf(stderr, "Accelrator is not computing bfloat16 euclidean distance correctly.\n");
+            LOG_ABORT("should not be reached");
+        }
+    }
+    a = createAndFillSignedBFloat16(testLength);
+    b = createAndFillSignedBFloat16(testLength);
+    for (size_t j(0); j < 0x20; j++) {
+        // Summation order differs between implementations, allow rounding differences
+        double dotSum(0);
+        double absDotSum(0);
+        double distSum(0);
+        for (size_t i(j); i < testLength; i++) {
+            double p = double(a[i].to_float()) * b[i].to_float();
+            dotSum += p;
+            absDotSum += std::abs(p);
+            double d = double(a[i].to_float()) - b[i].to_float();
+            distSum += d * d;
+        }
+        if (std::abs(dotSum - accel.dotProduct(&a[j], &b[j], testLength - j)) > absDotSum * 1e-4) {
+            fprintf(stderr, "Accelrator is not computing bfloat16 dotproduct of signed values correctly.\n");
+            LOG_ABORT("should not be reached");
+        }
+        if (std::abs(distSum - accel.squaredEuclideanDistance(&a[j], &b[j], testLength - j)) > distSum * 1e-4) {
+            fprintf(stderr, "Accelrator is not computing bfloat16 euclidean distance of signed values correctly.\n");
+            LOG_ABORT("should not be reached");
+        }
+    }
+}
+
 void
 verifyPopulationCount(const IAccelerated & accel)
 {
@@ -222,6 +316,8 @@ private:
         verifyDotproduct<int64_t>(accelerated);
         verifyEuclideanDistance<float>(accelerated);
         verifyEuclideanDistance<double>(accelerated);
+        verifyInt8(accelerated);
+        verifyBFloat16(accelerated);
         verifyPopulationCount(accelerated);
         verifyAnd64(accelerated);
         verifyOr64(accelerated);
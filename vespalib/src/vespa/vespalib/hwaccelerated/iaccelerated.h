@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include <vespa/vespalib/util/bfloat16.h>
 #include <memory>
 #include <cstdint>
 #include <vector>
@@ -23,6 +24,7 @@ public:
     virtual int64_t dotProduct(const int16_t * a, const int16_t * b, size_t sz) const noexcept = 0;
     virtual int64_t dotProduct(const int32_t * a, const int32_t * b, size_t sz) const noexcept = 0;
     virtual long long dotProduct(const int64_t * a, const int64_t * b, size_t sz) const noexcept = 0;
+    virtual float dotProduct(const BFloat16 * a, const BFloat16 * b, size_t sz) const noexcept = 0;
     virtual void orBit(void * a, const void * b, size_t bytes) const noexcept = 0;
     virtual void andBit(void * a, const void * b, size_t bytes) const noexcept = 0;
     virtual void andNotBit(void * a, const void * b, size_t bytes) const noexcept = 0;
@@ -32,6 +34,7 @@ public:
     virtual double squaredEuclideanDistance(const int8_t * a, const int8_t * b, size_t sz) const noexcept = 0;
     virtual double squaredEuclideanDistance(const float * a, const float * b, size_t sz) const noexcept = 0;
     virtual double squaredEuclideanDistance(const double * a, const double * b, size_t sz) const noexcept = 0;
+    virtual double squaredEuclideanDistance(const BFloat16 * a, const BFloat16 * b, size_t sz) const noexcept = 0;
     // AND 128 bytes from multiple, optionally inverted sources
     virtual void and128(size_t offset, const std::vector<std::pair<const void *, bool>> &src, void *dest) const noexcept = 0;
     // OR 128 bytes from multiple, optionally inverted sources
@@ -3,6 +3,7 @@
 #pragma once
 
 #include <vespa/config.h>
+#include <vespa/vespalib/util/bfloat16.h>
 #include <cstring>
 
 namespace vespalib::hwaccelerated::helper {
@@ -120,6 +121,48 @@ convert_bfloat16_to_float(const uint16_t *src, float *dest, size_t sz) noexcept
     }
 }
 
+template<size_t UNROLL = 16>
+float
+dotProduct(const BFloat16 *a, const BFloat16 *b, size_t sz) noexcept {
+    float partial[UNROLL] = {};
+    size_t i(0);
+    for (; i + UNROLL <= sz; i += UNROLL) {
+        for (size_t j(0); j < UNROLL; j++) {
+            partial[j] += a[i + j].to_float() * b[i + j].to_float();
+        }
+    }
+    for (; i < sz; i++) {
+        partial[i % UNROLL] += a[i].to_float() * b[i].to_float();
+    }
+    float sum(0);
+    for (size_t j(0); j < UNROLL; j++) {
+        sum += partial[j];
+    }
+    return sum;
+}
+
+template<size_t UNROLL = 16>
+double
+squaredEuclideanDistance(const BFloat16 *a, const BFloat16 *b, size_t sz) noexcept {
+    float partial[UNROLL] = {};
+    size_t i(0);
+    for (; i + UNROLL <= sz; i += UNROLL) {
+        for (size_t j(0); j < UNROLL; j++) {
+            float d = a[i + j].to_float() - b[i + j].to_float();
+            partial[j] += d * d;
+        }
+    }
+    for (; i < sz; i++) {
+        float d = a[i].to_float() - b[i].to_float();
+        partial[i % UNROLL] += d * d;
+    }
+    double sum(0);
+    for (size_t j(0); j < UNROLL; j++) {
+        sum += partial[j];
+    }
+    return sum;
+}
+
 template<typename ACCUM = uint32_t>
 ACCUM
 multiplyAddT(const int8_t *a, const int8_t *b, size_t sz) noexcept __attribute__((noinline));
@@ -44,7 +44,12 @@ ServerSocket::cleanup()
 }
 
 ServerSocket::ServerSocket(const SocketSpec &spec)
-    : _handle(adjust_blocking(spec.server_address().listen(), false)),
+    : ServerSocket(spec, false)
+{
+}
+
+ServerSocket::ServerSocket(const SocketSpec &spec, bool reuse_port)
+    : _handle(adjust_blocking(spec.server_address().listen(500, reuse_port), false)),
       _path(spec.path()),
       _blocking(true),
       _shutdown(false)
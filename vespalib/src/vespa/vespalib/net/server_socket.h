@@ -22,6 +22,12 @@ private:
 public:
     ServerSocket() : _handle(), _path(), _blocking(false), _shutdown(false) {}
     explicit ServerSocket(const SocketSpec &spec);
+    /**
+     * Listen with SO_REUSEPORT, letting several server sockets share
+     * the same tcp port. Incoming connections are distributed among them
+     * by the kernel. Not applicable to unix domain sockets.
+     **/
+    ServerSocket(const SocketSpec &spec, bool reuse_port);
     explicit ServerSocket(const std::string &spec);
     explicit ServerSocket(int port);
     ServerSocket(ServerSocket &&rhs);
@@ -173,7 +173,7 @@ SocketAddress::connect(const std::function<bool(SocketHandle&)> &tweak) const
 }
 
 SocketHandle
-SocketAddress::listen(int backlog) const
+SocketAddress::listen(int backlog, bool reuse_port) const
 {
     SocketHandle handle = raw_socket();
     if (handle.valid()) {
@@ -183,6 +183,9 @@ SocketAddress::listen(int backlog) const
         if (port() > 0) {
             handle.set_reuse_addr(true);
         }
+        if (reuse_port && !is_ipc() && !handle.set_reuse_port(true)) {
+            return SocketHandle();
+        }
         if ((bind(handle.get(), addr(), _size) == 0) &&
             (::listen(handle.get(), backlog) == 0))
         {
@@ -56,7 +56,7 @@ public:
     SocketHandle connect_async() const {
         return connect([](SocketHandle &handle){ return handle.set_blocking(false); });
     }
-    SocketHandle listen(int backlog = 500) const;
+    SocketHandle listen(int backlog = 500, bool reuse_port = false) const;
     static SocketAddress address_of(int sockfd);
     static SocketAddress peer_address(int sockfd);
     static std::vector<SocketAddress> resolve(int port, const char *node = nullptr);
@@ -47,6 +47,7 @@ public:
     bool set_blocking(bool value) { return SocketOptions::set_blocking(_fd, value); }
     bool set_nodelay(bool value) { return SocketOptions::set_nodelay(_fd, value); }
     bool set_reuse_addr(bool value) { return SocketOptions::set_reuse_addr(_fd, value); }
+    bool set_reuse_port(bool value) { return SocketOptions::set_reuse_port(_fd, value); }
     bool set_ipv6_only(bool value) { return SocketOptions::set_ipv6_only(_fd, value); }
     bool set_keepalive(bool value) { return SocketOptions::set_keepalive(_fd, value); }
     bool set_linger(bool enable, int value) { return SocketOptions::set_linger(_fd, enable, value); }
@@ -111,6 +111,15 @@ SocketSpec::replace_host(const std::string &new_host) const
     return SocketSpec();
 }
 
+SocketSpec
+SocketSpec::replace_port(int new_port) const
+{
+    if ((_type == Type::HOST_PORT) || (_type == Type::PORT)) {
+        return SocketSpec(_type, _node, new_port);
+    }
+    return SocketSpec();
+}
+
 const std::string &
 SocketSpec::host_with_fallback() const
 {
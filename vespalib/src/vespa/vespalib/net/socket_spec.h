@@ -28,6 +28,7 @@ public:
     explicit SocketSpec(const std::string &spec);
     std::string spec() const;
     SocketSpec replace_host(const std::string &new_host) const;
+    SocketSpec replace_port(int new_port) const;
     static SocketSpec from_path(const std::string &path) {
         return SocketSpec(Type::PATH, path, -1);
     }
@@ -4,6 +4,7 @@
 #include "lrucache_map.h"
 #include <vespa/vespalib/util/memoryusage.h>
 #include <atomic>
+#include <concepts>
 #include <mutex>
 
 namespace vespalib {
@@ -38,6 +39,9 @@ struct CacheParam : public P
  * This is a cache using the underlying lru implementation as the store. It is modelled as a pure cache
  * with an backing store underneath it. That backing store is given to the constructor and must of course have
  * proper lifetime. The store must implement the same 3 methods as the @ref NullStore above.
+ * The store may also implement 'bool admit(const K &, const V &) const', which is asked before inserting an
+ * object read from the store. Objects not admitted are returned without being inserted, and are counted
+ * separately from objects not found in the store.
  * Stuff is evicted from the cache if either number of elements or the accounted size passes the limits given.
  * The cache is thread safe by a single lock for accessing the underlying Lru. In addition a striped locking with
  * 64 locks chosen by the hash of the key to enable a single fetch for any element required by multiple readers.
@@ -104,6 +108,22 @@ public:
      */
     void write(const K & key, V value);
 
+    /**
+     * Return the generation of the given key. It must be captured before the caller fetches
+     * the object from the backing store itself, and then be given to populate().
+     */
+    uint64_t getGeneration(const K & key) const {
+        return _generations[stripe(key)].load(std::memory_order_acquire);
+    }
+
+    /**
+     * Insert an object already fetched from the backing store by the caller.
+     * The backing store is not touched, and an object already in the cache is kept.
+     * Nothing is inserted if the key has been written or invalidated since the given
+     * generation was captured, as the fetched object might then be stale.
+     */
+    void populate(const K & key, V value, uint64_t generation);
+
     /**
      * Tell if an object with given key exists in the cache.
      * Does not alter the LRU list.
@@ -115,6 +135,7 @@ public:
     size_t          getHit() const { return _hit.load(std::memory_order_relaxed); }
     size_t         getMiss() const { return _miss.load(std::memory_order_relaxed); }
     size_t getNoneExisting() const { return _noneExisting.load(std::memory_order_relaxed); }
+    size_t  getNotAdmitted() const { return _notAdmitted.load(std::memory_order_relaxed); }
     size_t         getRace() const { return _race.load(std::memory_order_relaxed); }
     size_t       getInsert() const { return _insert.load(std::memory_order_relaxed); }
     size_t        getWrite() const { return _write.load(std::memory_order_relaxed); }
@@ -135,10 +156,21 @@ private:
      * on the real size of the object pointed to.
      */
     bool removeOldest(const value_type & v) override;
+    bool admit(const K & k, const V & v) const {
+        if constexpr (requires (const BackingStore & s) { { s.admit(k, v) } -> std::convertible_to<bool>; }) {
+            return _store.admit(k, v);
+        } else {
+            return true;
+        }
+    }
     size_t calcSize(const K & k, const V & v) const { return sizeof(value_type) + _sizeK(k) + _sizeV(v); }
-    std::mutex & getLock(const K & k) {
+    size_t stripe(const K & k) const {
         size_t h(_hasher(k));
-        return _addLocks[h%(sizeof(_addLocks)/sizeof(_addLocks[0]))];
+        return h%(sizeof(_addLocks)/sizeof(_addLocks[0]));
+    }
+    std::mutex & getLock(const K & k) { return _addLocks[stripe(k)]; }
+    void bumpGeneration(const K & k, const UniqueLock &) {
+        _generations[stripe(k)].fetch_add(1, std::memory_order_release);
     }
 
     template <typename V>
@@ -158,6 +190,7 @@ private:
     mutable std::atomic<size_t> _hit;
     mutable std::atomic<size_t> _miss;
     std::atomic<size_t>         _noneExisting;
+    std::atomic<size_t>         _notAdmitted;
     mutable std::atomic<size_t> _race;
     mutable std::atomic<size_t> _insert;
     mutable std::atomic<size_t> _write;
@@ -168,6 +201,8 @@ private:
     mutable std::mutex          _hashLock;
     /// Striped locks that can be used for having a locked access to the backing store.
     std::mutex                  _addLocks[113];
+    /// Bumped, with the hash lock held, when a key in the corresponding stripe is written or invalidated.
+    std::atomic<uint64_t>       _generations[113];
 };
 
 }
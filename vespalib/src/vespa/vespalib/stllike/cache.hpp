@@ -46,13 +46,15 @@ cache<P>::cache(BackingStore & b, size_t maxBytes) :
     _hit(0),
     _miss(0),
     _noneExisting(0),
+    _notAdmitted(0),
     _race(0),
     _insert(0),
     _write(0),
     _update(0),
     _invalidate(0),
     _lookup(0),
-    _store(b)
+    _store(b),
+    _generations()
 { }
 
 template< typename P >
@@ -106,6 +108,10 @@ cache<P>::read(const K & key)
     }
     V value;
     if (_store.read(key, value)) {
+        if ( ! admit(key, value)) {
+            _notAdmitted.fetch_add(1);
+            return value;
+        }
         std::lock_guard guard(_hashLock);
         Lru::insert(key, value);
         _sizeBytes.store(sizeBytes() + calcSize(key, value), std::memory_order_relaxed);
@@ -132,13 +138,30 @@ cache<P>::write(const K & key, V value)
 
     _store.write(key, value);
     {
-        std::lock_guard guard(_hashLock);
+        UniqueLock guard(_hashLock);
+        bumpGeneration(key, guard);
         (*this)[key] = std::move(value);
         _sizeBytes.store(sizeBytes() + newSize, std::memory_order_relaxed);
         increment_stat(_write, guard);
     }
 }
 
+template< typename P >
+void
+cache<P>::populate(const K & key, V value, uint64_t generation)
+{
+    size_t newSize = calcSize(key, value);
+    std::lock_guard storeGuard(getLock(key));
+    std::lock_guard guard(_hashLock);
+    if (Lru::hasKey(key) || (getGeneration(key) != generation)) {
+        increment_stat(_race, guard);
+        return;
+    }
+    Lru::insert(key, std::move(value));
+    _sizeBytes.store(sizeBytes() + newSize, std::memory_order_relaxed);
+    increment_stat(_insert, guard);
+}
+
 template< typename P >
 void
 cache<P>::erase(const K & key)
@@ -153,6 +176,7 @@ void
 cache<P>::invalidate(const UniqueLock & guard, const K & key)
 {
     verifyHashLock(guard);
+    bumpGeneration(key, guard);
     if (Lru::hasKey(key)) {
         _sizeBytes.store(sizeBytes() - calcSize(key, (*this)[key]), std::memory_order_relaxed);
         increment_stat(_invalidate, guard);
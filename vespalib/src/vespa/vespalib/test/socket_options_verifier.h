@@ -42,6 +42,10 @@ struct SocketOptionsVerifier {
         SCOPED_TRACE("verify reuse addr");
         verify_bool_opt(fd, SOL_SOCKET, SO_REUSEADDR, value);
     }
+    void verify_reuse_port(bool value) {
+        SCOPED_TRACE("verify reuse port");
+        verify_bool_opt(fd, SOL_SOCKET, SO_REUSEPORT, value);
+    }
     void verify_ipv6_only(bool value) {
         SCOPED_TRACE("verify ipv6 only");
         verify_bool_opt(fd, IPPROTO_IPV6, IPV6_V6ONLY, value);
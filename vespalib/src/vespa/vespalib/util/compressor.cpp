@@ -81,13 +81,11 @@ compress(CompressionConfig::Type compression, const ConstBufferRef & org, DataBu
     return compress(CompressionConfig(compression), org, dest, allowSwap);
 }
 
+namespace {
+
 CompressionConfig::Type
-compress(CompressionConfig compression, const ConstBufferRef & org, DataBuffer & dest, bool allowSwap)
+fallbackIfUncompressed(CompressionConfig::Type type, const ConstBufferRef & org, DataBuffer & dest, bool allowSwap)
 {
-    CompressionConfig::Type type(CompressionConfig::NONE);
-    if (org.size() >= compression.minSize) {
-        type = docompress(compression, org, dest);
-    }
     if ((type == CompressionConfig::NONE) || (type == CompressionConfig::NONE_MULTI)) {
         if (allowSwap) {
             DataBuffer tmp(const_cast<char *>(org.c_str()), org.size());
@@ -100,6 +98,28 @@ compress(CompressionConfig compression, const ConstBufferRef & org, DataBuffer &
     return type;
 }
 
+}
+
+CompressionConfig::Type
+compress(CompressionConfig compression, const ConstBufferRef & org, DataBuffer & dest, bool allowSwap)
+{
+    CompressionConfig::Type type(CompressionConfig::NONE);
+    if (org.size() >= compression.minSize) {
+        type = docompress(compression, org, dest);
+    }
+    return fallbackIfUncompressed(type, org, dest, allowSwap);
+}
+
+CompressionConfig::Type
+compress(ICompressor & compressor, CompressionConfig compression, const ConstBufferRef & org, DataBuffer & dest, bool allowSwap)
+{
+    CompressionConfig::Type type(CompressionConfig::NONE);
+    if (compression.useCompression() && (org.size() >= compression.minSize)) {
+        type = compress(compressor, compression, org, dest);
+    }
+    return fallbackIfUncompressed(type, org, dest, allowSwap);
+}
+
 
 void
 decompress(ICompressor & decompressor, size_t uncompressedLen, const ConstBufferRef & org, DataBuffer & dest, bool allowSwap)
@@ -29,6 +29,10 @@ public:
  */
 CompressionConfig::Type compress(CompressionConfig::Type compression, const ConstBufferRef & org, DataBuffer & dest, bool allowSwap);
 CompressionConfig::Type compress(CompressionConfig compression, const vespalib::ConstBufferRef & org, vespalib::DataBuffer & dest, bool allowSwap);
+/**
+ * Same as above, but compresses with the given compressor instead of one selected by compression.type.
+ */
+CompressionConfig::Type compress(ICompressor & compressor, CompressionConfig compression, const ConstBufferRef & org, DataBuffer & dest, bool allowSwap);
 
 /**
  * Will try to decompress a buffer according to the config.
@@ -42,6 +46,10 @@ CompressionConfig::Type compress(CompressionConfig compression, const vespalib::
  * @param allowSwap will tell it the data must be appended or if it can be swapped in if compression type is NONE.
  */
 void decompress(CompressionConfig::Type compression, size_t uncompressedLen, const vespalib::ConstBufferRef & org, vespalib::DataBuffer & dest, bool allowSwap);
+/**
+ * Same as above, but decompresses with the given decompressor.
+ */
+void decompress(ICompressor & decompressor, size_t uncompressedLen, const ConstBufferRef & org, DataBuffer & dest, bool allowSwap);
 
 size_t computeMaxCompressedsize(CompressionConfig::Type type, size_t uncompressedSize);
 
@@ -2,7 +2,10 @@
 
 #include "zstdcompressor.h"
 #include <vespa/vespalib/util/alloc.h>
+#include <vespa/vespalib/util/exceptions.h>
+#include <vespa/vespalib/util/stringfmt.h>
 #include <zstd.h>
+#include <zdict.h>
 #include <cassert>
 
 using vespalib::alloc::Alloc;
@@ -60,4 +63,78 @@ ZStdCompressor::unprocess(const void * inputV, size_t inputLen, void * outputV,
     return ! ZSTD_isError(sz);
 }
 
+ZStdDictionary::ZStdDictionary(ConstBufferRef content)
+    : _content(content.c_str(), content.c_str() + content.size()),
+      _id(ZSTD_getDictID_fromDict(_content.data(), _content.size())),
+      _ddict(ZSTD_createDDict(_content.data(), _content.size())),
+      _cdict(nullptr),
+      _cdictOnce()
+{
+    if (_ddict == nullptr) {
+        throw IllegalArgumentException(make_string("Corrupt zstd dictionary of %zu bytes", _content.size()), VESPA_STRLOC);
+    }
+}
+
+ZStdDictionary::~ZStdDictionary()
+{
+    ZSTD_freeCDict(_cdict);
+    ZSTD_freeDDict(_ddict);
+}
+
+std::unique_ptr<ZStdDictionary>
+ZStdDictionary::train(ConstBufferRef samples, std::span<const size_t> sampleSizes, size_t maxSize)
+{
+    if (sampleSizes.empty() || (maxSize == 0)) {
+        return {};
+    }
+    std::vector<char> buffer(maxSize);
+    size_t sz = ZDICT_trainFromBuffer(buffer.data(), buffer.size(), samples.c_str(),
+                                      sampleSizes.data(), sampleSizes.size());
+    if (ZDICT_isError(sz)) {
+        return {};
+    }
+    return std::make_unique<ZStdDictionary>(ConstBufferRef(buffer.data(), sz));
+}
+
+const ZSTD_CDict *
+ZStdDictionary::compressDict(int compressionLevel) const
+{
+    std::call_once(_cdictOnce, [this, compressionLevel]() {
+        _cdict = ZSTD_createCDict(_content.data(), _content.size(), compressionLevel);
+    });
+    assert(_cdict != nullptr);
+    return _cdict;
+}
+
+size_t ZStdDictCompressor::adjustProcessLen(uint16_t, size_t len)   const { return ZSTD_compressBound(len); }
+
+bool
+ZStdDictCompressor::process(CompressionConfig config, const void * inputV, size_t inputLen, void * outputV, size_t & outputLenV)
+{
+    size_t maxOutputLen = ZSTD_compressBound(inputLen);
+    if ( ! _tlCompressState) {
+        _tlCompressState = std::make_unique<CompressContext>();
+    }
+    size_t sz = ZSTD_compress_usingCDict(_tlCompressState->get(), outputV, maxOutputLen, inputV, inputLen,
+                                         _dictionary.compressDict(config.compressionLevel));
+    assert( ! ZSTD_isError(sz) );
+    outputLenV = sz;
+    return ! ZSTD_isError(sz);
+}
+
+bool
+ZStdDictCompressor::unprocess(const void * inputV, size_t inputLen, void * outputV, size_t & outputLenV)
+{
+    if ( ! _tlDecompressState) {
+        _tlDecompressState = std::make_unique<DecompressContext>();
+    }
+    uint32_t frameDictId = ZSTD_getDictID_fromFrame(inputV, inputLen);
+    size_t sz = (frameDictId == 0)
+        ? ZSTD_decompressDCtx(_tlDecompressState->get(), outputV, outputLenV, inputV, inputLen)
+        : ZSTD_decompress_usingDDict(_tlDecompressState->get(), outputV, outputLenV, inputV, inputLen,
+                                     _dictionary.decompressDict());
+    outputLenV = ZSTD_isError(sz) ? 0 : sz;
+    return ! ZSTD_isError(sz);
+}
+
 }
@@ -2,6 +2,13 @@
 #pragma once
 
 #include "compressor.h"
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
+
+struct ZSTD_CDict_s;
+struct ZSTD_DDict_s;
 
 namespace vespalib::compression {
 
@@ -13,5 +20,51 @@ public:
     size_t adjustProcessLen(uint16_t options, size_t len)   const override;
 };
 
-}
+/**
+ * A trained zstd dictionary. The digested decompression dictionary is built up front,
+ * while the compression dictionary is built on first use with the compression level
+ * of that first use.
+ */
+class ZStdDictionary
+{
+public:
+    /**
+     * Throws IllegalArgumentException if the content is not a valid dictionary.
+     */
+    explicit ZStdDictionary(ConstBufferRef content);
+    ZStdDictionary(const ZStdDictionary &) = delete;
+    ZStdDictionary & operator=(const ZStdDictionary &) = delete;
+    ~ZStdDictionary();
+    /**
+     * Trains a dictionary of at most maxSize bytes from the given samples, which are stored
+     * back to back in samples. Returns nullptr if no dictionary could be trained.
+     */
+    static std::unique_ptr<ZStdDictionary> train(ConstBufferRef samples, std::span<const size_t> sampleSizes, size_t maxSize);
+    ConstBufferRef content() const { return {_content.data(), _content.size()}; }
+    uint32_t id() const { return _id; }
+    const ZSTD_CDict_s * compressDict(int compressionLevel) const;
+    const ZSTD_DDict_s * decompressDict() const { return _ddict; }
+private:
+    std::vector<char>             _content;
+    uint32_t                      _id;
+    ZSTD_DDict_s                * _ddict;
+    mutable ZSTD_CDict_s        * _cdict;
+    mutable std::once_flag        _cdictOnce;
+};
 
+/**
+ * Compresses with a trained dictionary. Frames that were compressed without a dictionary
+ * can still be decompressed.
+ */
+class ZStdDictCompressor : public ICompressor
+{
+public:
+    explicit ZStdDictCompressor(const ZStdDictionary & dictionary) noexcept : _dictionary(dictionary) { }
+    bool process(CompressionConfig config, const void * input, size_t inputLen, void * output, size_t & outputLen) override;
+    bool unprocess(const void * input, size_t inputLen, void * output, size_t & outputLen) override;
+    size_t adjustProcessLen(uint16_t options, size_t len)   const override;
+private:
+    const ZStdDictionary & _dictionary;
+};
+
+}